@@ -0,0 +1,72 @@
+#include "../include/figure_array.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Общая площадь ромбов при виртуальных вызовах через указатели (Array<Figure<double>*>),
+// при хранении по значению с явным вызовом без диспетчеризации (Array<Rhombus<double>>)
+// и для фигур на StaticFigure с вершинами внутри объекта (Array<FixedRhombus<double>>).
+//
+// Использование: devirt_bench [число фигур] [повторы]
+
+namespace {
+
+// Лучшее время из repeats запусков op в миллисекундах
+template <typename Op>
+double best_ms(size_t repeats, Op op) {
+    double best = 1e300;
+    for (size_t r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ms);
+    }
+    return best;
+}
+
+// Вершины i-го ромба
+std::array<Point<double>, 4> rhombus_vertices(size_t i) {
+    double x = static_cast<double>(i % 1000);
+    double h = 1.0 + static_cast<double>(i % 7);
+    return {Point<double>{x, 0}, {x + 2, h}, {x + 4, 0}, {x + 2, -h}};
+}
+
+std::unique_ptr<Point<double>[]> heap_vertices(size_t i) {
+    auto verts = rhombus_vertices(i);
+    auto points = std::make_unique<Point<double>[]>(4);
+    std::copy(verts.begin(), verts.end(), points.get());
+    return points;
+}
+
+template <typename Array>
+void run(const char* name, const Array& arr, size_t repeats) {
+    double area = 0.0;
+    double ms = best_ms(repeats, [&] { area = arr.total_area(); });
+    std::printf("%s: %8.2f ms (%.2f ns/figure), total area %.6g\n", name, ms, ms * 1e6 / arr.get_size(), area);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5;
+    std::printf("Figures: %zu\n", count);
+
+    // Массивы строятся по очереди, чтобы не держать в памяти все три
+    {
+        Array<Figure<double>*> arr(count);
+        for (size_t i = 0; i < count; ++i) arr.add(new Rhombus<double>(heap_vertices(i)));
+        run("virtual, Array<Figure<double>*>", arr, repeats);
+    }
+    {
+        Array<Rhombus<double>> arr(count);
+        for (size_t i = 0; i < count; ++i) arr.add(Rhombus<double>(heap_vertices(i)));
+        run("direct,  Array<Rhombus<double>> ", arr, repeats);
+    }
+    {
+        Array<FixedRhombus<double>> arr(count);
+        for (size_t i = 0; i < count; ++i) arr.add(FixedRhombus<double>(rhombus_vertices(i)));
+        run("static,  Array<FixedRhombus>    ", arr, repeats);
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "../include/rhombus.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Копирование и общая площадь ромбов с вершинами в куче (Rhombus) и внутри объекта (FixedRhombus).
+//
+// Использование: fixed_bench [число фигур] [повторы]
+
+namespace {
+
+// Лучшее время из repeats запусков op в миллисекундах
+template <typename Op>
+double best_ms(size_t repeats, Op op) {
+    double best = 1e300;
+    for (size_t r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ms);
+    }
+    return best;
+}
+
+template <typename Shape>
+void run(const char* name, const std::vector<Shape>& shapes, size_t repeats) {
+    size_t copied = 0;
+    double copy_ms = best_ms(repeats, [&] { std::vector<Shape> copy(shapes); copied += copy.size(); });
+    double area = 0.0;
+    double area_ms = best_ms(repeats, [&] {
+        area = 0.0;
+        for (const auto& s : shapes) area += static_cast<double>(s);
+    });
+    std::printf("%s: copy %.2f ms, area %.2f ms, total area %.6g\n", name, copy_ms, area_ms, area);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5;
+
+    std::vector<Rhombus<double>> heap;
+    std::vector<FixedRhombus<double>> fixed;
+    heap.reserve(count);
+    fixed.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        double x = static_cast<double>(i % 1000);
+        double h = 1.0 + static_cast<double>(i % 7);
+        std::array<Point<double>, 4> verts = {Point<double>{x, 0}, {x + 2, h}, {x + 4, 0}, {x + 2, -h}};
+        auto points = std::make_unique<Point<double>[]>(4);
+        std::copy(verts.begin(), verts.end(), points.get());
+        heap.emplace_back(std::move(points));
+        fixed.emplace_back(verts);
+    }
+
+    std::printf("Figures: %zu\n", count);
+    run("Rhombus     ", heap, repeats);
+    run("FixedRhombus", fixed, repeats);
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "../include/figure_kernels.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Пакетные площади, центры и проверка выпуклости для фигур с координатами double, float и int.
+// Фигуры - правильные пятиугольники (для int - с округленными вершинами), вершины всех фигур лежат подряд.
+//
+// Использование: kernel_bench [число фигур] [повторы]
+
+namespace {
+
+// Лучшее время из repeats запусков op в миллисекундах
+template <typename Op>
+double best_ms(size_t repeats, Op op) {
+    double best = 1e300;
+    for (size_t r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ms);
+    }
+    return best;
+}
+
+template <typename T>
+void run(const char* name, size_t count, size_t repeats) {
+    const size_t n = 5;
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    std::vector<Point<T>> verts(n * count);
+    for (size_t f = 0; f < count; ++f) {
+        double cx = coord(rng), cy = coord(rng);
+        for (size_t i = 0; i < n; ++i) {
+            double angle = 2 * M_PI * i / n;
+            verts[f * n + i] = {from_double<T>(cx + 3 * cos(angle)), from_double<T>(cy + 3 * sin(angle))};
+        }
+    }
+
+    std::vector<double> areas(count);
+    std::vector<Point<T>> centers(count);
+    std::unique_ptr<bool[]> convex(new bool[count]);
+    double area_ms = best_ms(repeats, [&] { batch_areas(verts.data(), n, count, areas.data()); });
+    double center_ms = best_ms(repeats, [&] { batch_centers(verts.data(), n, count, centers.data()); });
+    double convex_ms = best_ms(repeats, [&] { batch_convex(verts.data(), n, count, convex.get()); });
+
+    double total = 0.0;
+    for (double a : areas) total += a;
+    std::printf("%s: vertices %zu MiB, areas %.2f ms, centers %.2f ms, convex %.2f ms, total area %.6g\n", name,
+                verts.size() * sizeof(Point<T>) >> 20, area_ms, center_ms, convex_ms, total);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5;
+
+    std::printf("Figures: %zu\n", count);
+    run<double>("double", count, repeats);
+    run<float>("float ", count, repeats);
+    run<int>("int   ", count, repeats);
+    return 0;
+}
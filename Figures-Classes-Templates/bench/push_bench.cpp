@@ -0,0 +1,51 @@
+#include "../include/figure_array.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Скорость добавления в конец: Array<Figure<double>*> (указатели копируются при росте побайтово)
+// и Array<FixedRhombus<float>> (фигуры по значению), с reserve и без; для сравнения - std::vector.
+// Указатели нулевые, фигуры созданы конструктором по умолчанию: измеряется только сам массив.
+//
+// Использование: push_bench [число указателей] [число фигур по значению]
+
+namespace {
+
+template <typename Op>
+double elapsed_ms(Op op) {
+    auto start = std::chrono::steady_clock::now();
+    op();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Container, typename Push>
+void run(const char* name, size_t count, bool reserve, Push push) {
+    double ms = elapsed_ms([&] {
+        Container c;
+        if (reserve) c.reserve(count);
+        for (size_t i = 0; i < count; ++i) push(c, i);
+    });
+    std::printf("%-40s %9.1f ms (%.2f ns/push)\n", name, ms, ms * 1e6 / count);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t pointers = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    size_t values = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20000000;
+
+    std::printf("Pointers: %zu, values: %zu\n", pointers, values);
+    auto push_pointer = [](auto& c, size_t) { c.push_back(nullptr); };
+    auto add_pointer = [](auto& c, size_t) { c.add(nullptr); };
+    run<std::vector<Figure<double>*>>("std::vector<Figure<double>*>", pointers, false, push_pointer);
+    run<Array<Figure<double>*>>("Array<Figure<double>*>", pointers, false, add_pointer);
+    run<Array<Figure<double>*>>("Array<Figure<double>*>, reserve", pointers, true, add_pointer);
+
+    auto push_value = [](auto& c, size_t) { c.push_back(FixedRhombus<float>()); };
+    auto add_value = [](auto& c, size_t) { c.emplace_back(); };
+    run<std::vector<FixedRhombus<float>>>("std::vector<FixedRhombus<float>>", values, false, push_value);
+    run<Array<FixedRhombus<float>>>("Array<FixedRhombus<float>>", values, false, add_value);
+    run<Array<FixedRhombus<float>>>("Array<FixedRhombus<float>>, reserve", values, true, add_value);
+    return 0;
+}
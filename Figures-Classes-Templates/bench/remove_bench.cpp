@@ -0,0 +1,57 @@
+#include "../include/figure_array.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Удаление всех фигур из Array<Figure<double>*> с начала массива:
+// pop со сдвигом (O(n) на удаление), pop_swap (O(1)) и remove_later с одним сжатием в конце (O(1) в среднем).
+//
+// Использование: remove_bench [число фигур]
+
+namespace {
+
+std::unique_ptr<Point<double>[]> rhombus_vertices(size_t i) {
+    double x = static_cast<double>(i % 1000);
+    auto points = std::make_unique<Point<double>[]>(4);
+    points[0] = {x, 0};
+    points[1] = {x + 2, 1};
+    points[2] = {x + 4, 0};
+    points[3] = {x + 2, -1};
+    return points;
+}
+
+// Время удаления всех фигур в миллисекундах (построение массива не входит)
+template <typename Remove>
+double remove_all_ms(size_t count, Remove remove) {
+    Array<Figure<double>*> arr;
+    arr.reserve(count);
+    for (size_t i = 0; i < count; ++i) arr.emplace_back(new Rhombus<double>(rhombus_vertices(i)));
+    auto start = std::chrono::steady_clock::now();
+    remove(arr, count);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (arr.get_size() != 0) std::printf("not empty: %zu\n", arr.get_size());
+    return ms;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    std::printf("Figures: %zu\n", count);
+
+    double pop_ms = remove_all_ms(count, [](auto& arr, size_t n) {
+        for (size_t i = 0; i < n; ++i) arr.pop(0);
+    });
+    double swap_ms = remove_all_ms(count, [](auto& arr, size_t n) {
+        for (size_t i = 0; i < n; ++i) arr.pop_swap(0);
+    });
+    // Индексы не сдвигаются до сжатия: все фигуры помечаются по порядку, затем одно сжатие
+    double later_ms = remove_all_ms(count, [](auto& arr, size_t n) {
+        for (size_t i = 0; i < n; ++i) arr.remove_later(i);
+        arr.compact();
+    });
+    std::printf("pop:          %10.2f ms\n", pop_ms);
+    std::printf("pop_swap:     %10.2f ms\n", swap_ms);
+    std::printf("remove_later: %10.2f ms\n", later_ms);
+    return 0;
+}
@@ -6,6 +6,8 @@
 #include <stdexcept>
 #include <algorithm>
 #include "point.hpp"
+#include "vertex_order.hpp"
+#include "figure_kernels.hpp"
 
 
 template <typename T>
@@ -56,6 +58,11 @@ public:
     // Площадь через приведение к double
     virtual operator double() const;
 
+    // Удвоенная площадь без округлений (для целых координат, WideInt<T>)
+    auto twice_area() const requires std::integral<T> {
+        return twice_area_of(this->vertices.get(), this->vertices_num);
+    }
+
     // Проверка на равенство
     virtual bool equals(const Figure& other) const;
 
@@ -174,54 +181,23 @@ bool Figure<T>::equals(const Figure& other) const {
 // Нахождение центроида
 template <typename T>
 Point<T> Figure<T>::center() const {
-    Point<T> center;
-    for (size_t i = 0; i < this->vertices_num; ++i) {
-        center = center + this->vertices[i];
-    }
-    return center / this->vertices_num;
+    return figure_kernels_detail::center_of(this->vertices.get(), this->vertices_num);
 }
 
-// Сортировка вершин по порядку обхода
+// Сортировка вершин по порядку обхода вокруг точного среднего вершин
 template <typename T>
 void Figure<T>::sortVertices() {
-    Point<T> c = center();
-    std::sort(vertices.get(), vertices.get() + vertices_num, [&](const Point<T>& a, const Point<T>& b) {
-        double angleA = atan2(static_cast<double>(a.y) - static_cast<double>(c.y), static_cast<double>(a.x) - static_cast<double>(c.x));
-        double angleB = atan2(static_cast<double>(b.y) - static_cast<double>(c.y), static_cast<double>(b.x) - static_cast<double>(c.x));
-        return angleA < angleB;
-    });
+    order_vertices_around_mean(vertices.get(), vertices_num);
 }
 
 // Нахождение площади с помощью метода шнурков
 template <typename T>
 Figure<T>::operator double() const {
-    double S = 0;
-    double sum1 = 0;
-    double sum2 = 0;
-    for (size_t i = 0; i < this->vertices_num - 1; ++i) {
-        sum1 += static_cast<double>(this->vertices[i].x) * static_cast<double>(this->vertices[i + 1].y);
-        sum2 += static_cast<double>(this->vertices[i].y) * static_cast<double>(this->vertices[i + 1].x);
-    }
-    sum1 += static_cast<double>(this->vertices[vertices_num - 1].x) * static_cast<double>(this->vertices[0].y);
-    sum2 += static_cast<double>(this->vertices[vertices_num - 1].y) * static_cast<double>(this->vertices[0].x);
-    S = 0.5 * fabs(sum1 - sum2);
-    return S;
+    return figure_kernels_detail::area_of(this->vertices.get(), this->vertices_num);
 }
 
 // Проверка на выпуклость
 template <typename T>
 bool Figure<T>::isConvex() const {
-    if (vertices_num < 3) return true;
-    int sign = 0;
-    for (size_t i = 0; i < vertices_num; ++i) {
-        Point<T> a = vertices[i];
-        Point<T> b = vertices[(i + 1) % vertices_num];
-        Point<T> c = vertices[(i + 2) % vertices_num];
-        double cross = (static_cast<double>(b.x) - static_cast<double>(a.x)) * (static_cast<double>(c.y) - static_cast<double>(a.y)) - (static_cast<double>(b.y) - static_cast<double>(a.y)) * (static_cast<double>(c.x) - static_cast<double>(a.x));
-        if (cross == 0) continue; // коллинеарные точки, пропускаем
-        int current_sign = (cross > 0) ? 1 : -1;
-        if (sign == 0) sign = current_sign;
-        else if (sign != current_sign) return false;
-    }
-    return true;
+    return figure_kernels_detail::convex_of(this->vertices.get(), this->vertices_num);
 }
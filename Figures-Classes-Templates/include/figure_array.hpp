@@ -2,8 +2,35 @@
 #include "trapezoid.hpp"
 #include "rhombus.hpp"
 #include "pentagon.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 
+// Объект типа T можно перенести в другую память побайтовым копированием, не вызывая конструктор
+// перемещения и деструктор старого объекта. Язык гарантирует это только для тривиально копируемых
+// типов (указатели на фигуры, FixedRhombus и др.); фигуры с виртуальными функциями (Rhombus и др.)
+// переносятся конструктором перемещения
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = std::is_trivially_copyable_v<T>;
+
+// Динамический массив фигур: T - указатель на фигуру (массив владеет фигурами) или фигура по значению.
+//
+// Способы удаления и порядок элементов:
+// pop(index)          - O(n), порядок остальных элементов сохраняется, следующие сдвигаются на одну позицию;
+// pop_swap(index)     - O(1), на место удаленного встает последний элемент, порядок не сохраняется;
+// remove_later(index) - O(1), элемент помечается удаленным, индексы всех элементов не меняются до сжатия.
+//                       Сжатие (compact) убирает все помеченные элементы за один проход с сохранением
+//                       порядка оставшихся и выполняется только при явном вызове. Помеченные слоты
+//                       занимают память до сжатия; should_compact подсказывает, когда их набралась половина.
+// Помеченные элементы пропускаются в total_area, array_center, array_square и write.
+//
+// Элементы лежат в памяти без предварительного конструирования: слоты после size не заняты,
+// элементы создаются на месте (emplace_back). При росте побайтово переносимые элементы
+// (is_trivially_relocatable_v) копируются одним блоком, остальные перемещаются по одному
 template <typename T>
 class Array
 {
@@ -31,12 +58,44 @@ public:
     // Изменение размера
     virtual void resize(const size_t new_size); 
 
+    // Память не меньше чем под n элементов
+    void reserve(size_t n) { resize(n); }
+
     // Добавление элемента в массив
     virtual void add(T f);
 
-    // Удаление по индексу
+    // Создание элемента в конце массива из аргументов конструктора T
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    // Удаление по индексу со сдвигом следующих элементов
     virtual void pop(size_t index);
 
+    // Удаление по индексу за O(1): на его место переносится последний элемент
+    void pop_swap(size_t index);
+
+    // Пометка элемента удаленным (для указателей фигура удаляется сразу)
+    void remove_later(size_t index);
+
+    // Удаление помеченных элементов, возвращает их число
+    size_t compact();
+
+    // Элемент помечен удаленным и ждет сжатия
+    bool is_removed(size_t index) const { return removed_count > 0 && removed[index]; }
+
+    // Число помеченных элементов
+    size_t get_removed() const { return removed_count; }
+
+    // Помечена хотя бы половина массива: сжатие окупается (в среднем O(1) на удаление)
+    bool should_compact() const { return removed_count > 0 && 2 * removed_count >= size; }
+
+    // Элемент по индексу
+    const T& get(size_t index) const {
+        if (index >= size) throw std::out_of_range("Index out of range");
+        if (is_removed(index)) throw std::out_of_range("Element is removed");
+        return array[index];
+    }
+
     // Печатаем геометрический центр (центроид) всех фигур
     virtual void array_center() const;
 
@@ -46,7 +105,7 @@ public:
     // Общая площадь всех фигур
     virtual double total_area() const;
 
-    // Получить размер
+    // Получить размер (вместе с помеченными элементами)
     size_t get_size() const { return size; }
 
     // Чтение/запись
@@ -64,7 +123,29 @@ public:
 private:
     size_t size;
     size_t capacity;
-    std::shared_ptr<T[]> array;
+    T* array;
+
+    // Пометки удаленных элементов (пустой вектор, пока помеченных нет)
+    std::vector<bool> removed;
+    size_t removed_count = 0;
+
+    // Побайтовый перенос при росте; при обычном выравнивании память берется через malloc,
+    // и рост идет через realloc (расширение на месте или перенос страниц без копирования)
+    static constexpr bool RELOCATABLE = is_trivially_relocatable_v<T>;
+    static constexpr bool USE_REALLOC = RELOCATABLE && alignof(T) <= alignof(std::max_align_t);
+
+    // Память под n элементов без их конструирования и ее освобождение
+    static T* allocate(size_t n);
+    static void deallocate(T* p, size_t n);
+
+    // Освобождение фигур, которыми владеет массив
+    void delete_figures();
+
+    // Разрушение всех элементов и освобождение памяти
+    void release();
+
+    // Копирование неудаленных элементов other в пустой массив
+    void copy_from(const Array& other);
 };
 
 // Implementations
@@ -78,131 +159,271 @@ Array<T>::Array(size_t n) {
     if (n > 0) {
         while (n > capacity) capacity *= 2;
     }
-    this->array = std::make_shared<T[]>(capacity);
+    this->array = allocate(capacity);
     this->size = 0;
 }
 
 template <typename T>
-Array<T>::Array(const Array& other) : size(other.size), capacity(other.capacity) {
-    if (this->size > 0) {
-        this->array = std::make_shared<T[]>(capacity);
-        for (size_t i = 0; i < this->size; ++i) {
-            if constexpr (std::is_pointer_v<T>) {
-                this->array[i] = static_cast<T>(other.array[i]->clone());
-            } else {
-                this->array[i] = other.array[i];
-            }
-        }
+Array<T>::Array(const Array& other) : size(0), capacity(other.capacity) {
+    this->array = allocate(capacity);
+    try {
+        copy_from(other);
+    } catch (...) {
+        release();
+        throw;
     }
 }
 
 template <typename T>
 Array<T>& Array<T>::operator=(const Array& other) {
-    if (this->capacity > 0) {
-        if constexpr (std::is_pointer_v<T>) {
-            for (size_t i = 0; i < this->size; ++i) {
-                delete this->array[i];
-            }
-        }
-    }
-    this->size = other.size;
-    this->capacity = other.capacity;
-    this->array = std::make_shared<T[]>(this->capacity);
-    for (size_t i = 0; i < other.size; ++i) {
-        if constexpr (std::is_pointer_v<T>) {
-            this->array[i] = static_cast<T>(other.array[i]->clone());
-        } else {
-            this->array[i] = other.array[i];
-        }
+    if (this != &other) {
+        Array copy(other);
+        *this = std::move(copy);
     }
     return *this;
 }
 
 template <typename T>
-Array<T>::Array(Array&& other) noexcept : size(other.size), capacity(other.capacity), array(other.array) {
+Array<T>::Array(Array&& other) noexcept
+    : size(other.size), capacity(other.capacity), array(other.array),
+      removed(std::move(other.removed)), removed_count(other.removed_count) {
     other.size = 0;
     other.capacity = 0;
     other.array = nullptr;    
+    other.removed.clear();
+    other.removed_count = 0;
 }
 
 template <typename T>
 Array<T>& Array<T>::operator=(Array&& other) noexcept {
-    if (this->capacity > 0) {
-        if constexpr (std::is_pointer_v<T>) {
-            for (size_t i = 0; i < this->size; ++i) {
-                delete this->array[i];
-            }
-        }
+    if (this != &other) {
+        release();
+        this->size = other.size;
+        this->capacity = other.capacity;
+        this->array = other.array;
+        this->removed = std::move(other.removed);
+        this->removed_count = other.removed_count;
+        other.size = 0;
+        other.capacity = 0;
+        other.array = nullptr;
+        other.removed.clear();
+        other.removed_count = 0;
     }
-    this->size = other.size;
-    this->capacity = other.capacity;
-    this->array = other.array;
-    other.size = 0;
-    other.capacity = 0;
-    other.array = nullptr;
     return *this;
 }
 
 template <typename T>
 Array<T>::~Array() {
-    if (this->capacity > 0) {
+    release();
+}
+
+template <typename T>
+T* Array<T>::allocate(size_t n) {
+    if constexpr (USE_REALLOC) {
+        void* p = std::malloc(std::max<size_t>(n, 1) * sizeof(T));
+        if (p == nullptr) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    } else {
+        return std::allocator<T>().allocate(n);
+    }
+}
+
+template <typename T>
+void Array<T>::deallocate(T* p, size_t n) {
+    if (p == nullptr) return;
+    if constexpr (USE_REALLOC) {
+        std::free(p);
+    } else {
+        std::allocator<T>().deallocate(p, n);
+    }
+}
+
+template <typename T>
+void Array<T>::delete_figures() {
+    // Помеченные указатели уже удалены и обнулены
+    if constexpr (std::is_pointer_v<T>) {
+        for (size_t i = 0; i < this->size; ++i) {
+            delete this->array[i];
+        }
+    }
+}
+
+template <typename T>
+void Array<T>::release() {
+    delete_figures();
+    std::destroy(this->array, this->array + this->size);
+    deallocate(this->array, this->capacity);
+    this->array = nullptr;
+    this->size = 0;
+    this->capacity = 0;
+    this->removed.clear();
+    this->removed_count = 0;
+}
+
+template <typename T>
+void Array<T>::copy_from(const Array& other) {
+    for (size_t i = 0; i < other.size; ++i) {
+        if (other.is_removed(i)) continue;
         if constexpr (std::is_pointer_v<T>) {
-            for (size_t i = 0; i < this->size; ++i) {
-                delete this->array[i];
-            }
+            std::construct_at(this->array + this->size, static_cast<T>(other.array[i]->clone()));
+        } else {
+            std::construct_at(this->array + this->size, other.array[i]);
         }
+        ++this->size;
     }
 }
 
 template <typename T>
 void Array<T>::resize(const size_t new_capacity) {
     if (new_capacity <= this->capacity) return;
-    size_t new_cap = this->capacity;
+    size_t new_cap = std::max<size_t>(this->capacity, 1);
     while (new_cap < new_capacity) new_cap *= 2;
-    auto new_array = std::make_shared<T[]>(new_cap);
-    for (size_t i = 0; i < this->size; ++i) {
-        if constexpr (std::is_pointer_v<T>) {
-            new_array[i] = this->array[i];
+
+    if constexpr (USE_REALLOC) {
+        void* p = std::realloc(static_cast<void*>(this->array), new_cap * sizeof(T));
+        if (p == nullptr) throw std::bad_alloc();
+        this->array = static_cast<T*>(p);
+    } else {
+        T* new_array = allocate(new_cap);
+        if constexpr (RELOCATABLE) {
+            std::memcpy(static_cast<void*>(new_array), static_cast<const void*>(this->array), this->size * sizeof(T));
+        } else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            std::uninitialized_move(this->array, this->array + this->size, new_array);
+            std::destroy(this->array, this->array + this->size);
         } else {
-            new_array[i] = std::move(this->array[i]);
+            // Копирование может бросить исключение: старый массив остается нетронутым
+            try {
+                std::uninitialized_copy(this->array, this->array + this->size, new_array);
+            } catch (...) {
+                deallocate(new_array, new_cap);
+                throw;
+            }
+            std::destroy(this->array, this->array + this->size);
         }
+        deallocate(this->array, this->capacity);
+        this->array = new_array;
     }
-    this->array = new_array;
     this->capacity = new_cap;
 }
 
 template <typename T>
 void Array<T>::add(T f) {
-    if (this->size + 1 > capacity) {
-        this->resize(this->size + 1);
+    emplace_back(std::move(f));
+}
+
+template <typename T>
+template <typename... Args>
+T& Array<T>::emplace_back(Args&&... args) {
+    if (this->removed_count > 0) {
+        this->removed.reserve(this->size + 1);
     }
-    if constexpr (std::is_pointer_v<T>) {
-        this->array[this->size] = f;
+    T* slot;
+    if (this->size == this->capacity) {
+        // Аргументы могут ссылаться на элементы массива, поэтому элемент создается до переноса
+        T value(std::forward<Args>(args)...);
+        this->resize(this->size + 1);
+        slot = std::construct_at(this->array + this->size, std::move(value));
     } else {
-        this->array[this->size] = std::move(f);
+        slot = std::construct_at(this->array + this->size, std::forward<Args>(args)...);
+    }
+    if (this->removed_count > 0) {
+        this->removed.push_back(false);
     }
     ++this->size;
+    return *slot;
 }
 
 template <typename T>
 void Array<T>::pop(size_t index) {
+    if (index >= this->size) throw std::out_of_range("Index out of range");
     if constexpr (std::is_pointer_v<T>) {
         delete this->array[index];
     }
-    for (size_t i = index + 1; i < this->size; ++i) {
-        this->array[i - 1] = this->array[i];
+    if constexpr (RELOCATABLE) {
+        // Следующие элементы сдвигаются одним блоком
+        std::destroy_at(this->array + index);
+        std::memmove(static_cast<void*>(this->array + index), static_cast<const void*>(this->array + index + 1),
+                     (this->size - index - 1) * sizeof(T));
+        --this->size;
+    } else {
+        std::move(this->array + index + 1, this->array + this->size, this->array + index);
+        --this->size;
+        std::destroy_at(this->array + this->size);
+    }
+    if (this->removed_count > 0) {
+        this->removed_count -= this->removed[index];
+        this->removed.erase(this->removed.begin() + index);
+        if (this->removed_count == 0) this->removed.clear();
+    }
+}
+
+template <typename T>
+void Array<T>::pop_swap(size_t index) {
+    if (index >= this->size) throw std::out_of_range("Index out of range");
+    if constexpr (std::is_pointer_v<T>) {
+        delete this->array[index];
+    }
+    size_t last = this->size - 1;
+    if (index != last) {
+        this->array[index] = std::move(this->array[last]);
     }
+    std::destroy_at(this->array + last);
     --this->size;
-    this->array[this->size] = T{};
+    if (this->removed_count > 0) {
+        this->removed_count -= this->removed[index];
+        this->removed[index] = this->removed[last];
+        this->removed.pop_back();
+        if (this->removed_count == 0) this->removed.clear();
+    }
+}
+
+template <typename T>
+void Array<T>::remove_later(size_t index) {
+    if (index >= this->size) throw std::out_of_range("Index out of range");
+    if (is_removed(index)) return;
+    if (this->removed_count == 0) {
+        this->removed.assign(this->size, false);
+    }
+    this->removed[index] = true;
+    ++this->removed_count;
+    if constexpr (std::is_pointer_v<T>) {
+        delete this->array[index];
+        this->array[index] = nullptr;
+    }
+}
+
+template <typename T>
+size_t Array<T>::compact() {
+    if (this->removed_count == 0) return 0;
+    size_t kept = 0;
+    for (size_t i = 0; i < this->size; ++i) {
+        if (this->removed[i]) continue;
+        if (kept != i) {
+            this->array[kept] = std::move(this->array[i]);
+        }
+        ++kept;
+    }
+    std::destroy(this->array + kept, this->array + this->size);
+    size_t count = this->size - kept;
+    this->size = kept;
+    this->removed.clear();
+    this->removed_count = 0;
+    return count;
 }
 
+// Элементы, хранящиеся по значению, имеют ровно тип T (наследник в массив не помещается),
+// поэтому функции фигур вызываются с явным указанием класса T: без виртуальной диспетчеризации,
+// с возможностью встраивания. Для Array<Rhombus<double>> это однородный быстрый путь,
+// для фигур на StaticFigure (FixedRhombus и др.) вызовы и так не виртуальные
+
 template <typename T>
 void Array<T>::array_center() const {
     for (size_t i = 0; i < this->size; ++i) {
+        if (is_removed(i)) continue;
         if constexpr (std::is_pointer_v<T>) {
             std::cout << this->array[i]->center() << std::endl;
         } else {
-            std::cout << this->array[i].center() << std::endl;
+            std::cout << this->array[i].T::center() << std::endl;
         }
     }
 }
@@ -210,10 +431,11 @@ void Array<T>::array_center() const {
 template <typename T>
 void Array<T>::array_square() const {
     for (size_t i = 0; i < this->size; ++i) {
+        if (is_removed(i)) continue;
         if constexpr (std::is_pointer_v<T>) {
             std::cout << static_cast<double>(*(this->array[i])) << std::endl;
         } else {
-            std::cout << static_cast<double>(this->array[i]) << std::endl;
+            std::cout << this->array[i].T::operator double() << std::endl;
         }
     }
 }
@@ -222,10 +444,11 @@ template <typename T>
 double Array<T>::total_area() const {
     double sum = 0.0;
     for (size_t i = 0; i < this->size; ++i) {
+        if (is_removed(i)) continue;
         if constexpr (std::is_pointer_v<T>) {
             sum += static_cast<double>(*(this->array[i]));
         } else {
-            sum += static_cast<double>(this->array[i]);
+            sum += this->array[i].T::operator double();
         }
     }
     return sum;
@@ -239,6 +462,7 @@ void Array<T>::read(std::istream& in) {
 template <typename T>
 void Array<T>::write(std::ostream& out) const {
     for (size_t i = 0; i < this->size; ++i) {
+        if (is_removed(i)) continue;
         if constexpr (std::is_pointer_v<T>) {
             out << this->array[i]->type() << " " << *(this->array[i]) << std::endl;
         } else {
@@ -0,0 +1,424 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "point.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FIGURE_KERNELS_AVX2 1
+#include <immintrin.h>
+#endif
+
+// Пакетные вычисления над count фигурами по n вершин, лежащими подряд в verts
+// (та же раскладка, что у order_vertices_batch): площадь, центр и выпуклость.
+// Формулы и порядок операций те же, что в Figure<T>: координаты приводятся к double,
+// поэтому для float и целых координат произведения и суммы не теряют точность.
+//
+// Для целых координат вычисления точные и без плавающей точки: удвоенная площадь и векторные
+// произведения считаются в целых типах WideInt, в double переводится только итоговая площадь.
+//
+// Для Point<float> есть версии на AVX2: в 256-битный регистр помещаются координаты
+// восьми фигур (вдвое больше, чем для double), вычисления идут в double по половинам регистра.
+// Для Point<int32_t> с координатами по модулю не больше 2^24 (сеточные данные) - целочисленные
+// версии на AVX2 с 64-битными произведениями. Результаты совпадают с обычной версией бит в бит.
+
+// Целый тип для точных произведений и сумм произведений координат
+template <typename T> requires std::integral<T>
+using WideInt = std::conditional_t<(sizeof(T) <= 2), int64_t, __int128>;
+
+// Целый тип для точных сумм координат (без произведений)
+template <typename T> requires std::integral<T>
+using SumInt = std::conditional_t<(sizeof(T) <= 4), int64_t, __int128>;
+
+// Квадрат расстояния между точками с целыми координатами
+template <typename T> requires std::integral<T>
+constexpr WideInt<T> squared_distance(const Point<T>& a, const Point<T>& b) {
+    WideInt<T> dx = static_cast<WideInt<T>>(a.x) - static_cast<WideInt<T>>(b.x);
+    WideInt<T> dy = static_cast<WideInt<T>>(a.y) - static_cast<WideInt<T>>(b.y);
+    return dx * dx + dy * dy;
+}
+
+// Векторное произведение (b - a) x (c - a) для целых координат
+template <typename T> requires std::integral<T>
+constexpr WideInt<T> cross_exact(const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+    using W = WideInt<T>;
+    return (static_cast<W>(b.x) - static_cast<W>(a.x)) * (static_cast<W>(c.y) - static_cast<W>(a.y)) -
+           (static_cast<W>(b.y) - static_cast<W>(a.y)) * (static_cast<W>(c.x) - static_cast<W>(a.x));
+}
+
+// Удвоенная площадь многоугольника с целыми координатами (метод шнурков, без округлений)
+template <typename T> requires std::integral<T>
+constexpr WideInt<T> twice_area_of(const Point<T>* v, size_t n) {
+    using W = WideInt<T>;
+    W sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const Point<T>& a = v[i];
+        const Point<T>& b = v[(i + 1) % n];
+        sum += static_cast<W>(a.x) * static_cast<W>(b.y) - static_cast<W>(a.y) * static_cast<W>(b.x);
+    }
+    return sum < 0 ? -sum : sum;
+}
+
+// Частное sum / n с округлением к ближайшему целому, половины - от нуля (как from_double)
+template <typename T> requires std::integral<T>
+constexpr T rounded_quotient(SumInt<T> sum, size_t n) {
+    SumInt<T> count = static_cast<SumInt<T>>(n);
+    SumInt<T> q = sum / count;
+    SumInt<T> r = sum % count;
+    if (2 * (r < 0 ? -r : r) >= count) q += sum < 0 ? -1 : 1;
+    return static_cast<T>(q);
+}
+
+namespace figure_kernels_detail {
+
+// Площадь по методу шнурков
+template <typename T>
+double area_of(const Point<T>* v, size_t n) {
+    if constexpr (std::integral<T>) {
+        return 0.5 * static_cast<double>(twice_area_of(v, n));
+    }
+    double sum1 = 0;
+    double sum2 = 0;
+    for (size_t i = 0; i + 1 < n; ++i) {
+        sum1 += static_cast<double>(v[i].x) * static_cast<double>(v[i + 1].y);
+        sum2 += static_cast<double>(v[i].y) * static_cast<double>(v[i + 1].x);
+    }
+    sum1 += static_cast<double>(v[n - 1].x) * static_cast<double>(v[0].y);
+    sum2 += static_cast<double>(v[n - 1].y) * static_cast<double>(v[0].x);
+    return 0.5 * fabs(sum1 - sum2);
+}
+
+// Центр как среднее вершин
+template <typename T>
+Point<T> center_of(const Point<T>* v, size_t n) {
+    if constexpr (std::integral<T>) {
+        SumInt<T> sum_x = 0;
+        SumInt<T> sum_y = 0;
+        for (size_t i = 0; i < n; ++i) {
+            sum_x += v[i].x;
+            sum_y += v[i].y;
+        }
+        return {rounded_quotient<T>(sum_x, n), rounded_quotient<T>(sum_y, n)};
+    }
+    double sum_x = 0.0;
+    double sum_y = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        sum_x += static_cast<double>(v[i].x);
+        sum_y += static_cast<double>(v[i].y);
+    }
+    return {from_double<T>(sum_x / static_cast<double>(n)), from_double<T>(sum_y / static_cast<double>(n))};
+}
+
+// Выпуклость: повороты во всех тройках соседних вершин одного знака (коллинеарные пропускаются)
+template <typename T>
+bool convex_of(const Point<T>* v, size_t n) {
+    if (n < 3) return true;
+    bool has_positive = false;
+    bool has_negative = false;
+    for (size_t i = 0; i < n; ++i) {
+        const Point<T>& a = v[i];
+        const Point<T>& b = v[(i + 1) % n];
+        const Point<T>& c = v[(i + 2) % n];
+        if constexpr (std::integral<T>) {
+            WideInt<T> cross = cross_exact(a, b, c);
+            has_positive |= cross > 0;
+            has_negative |= cross < 0;
+            continue;
+        }
+        double cross = (static_cast<double>(b.x) - static_cast<double>(a.x)) * (static_cast<double>(c.y) - static_cast<double>(a.y)) -
+                       (static_cast<double>(b.y) - static_cast<double>(a.y)) * (static_cast<double>(c.x) - static_cast<double>(a.x));
+        has_positive |= cross > 0;
+        has_negative |= cross < 0;
+    }
+    return !(has_positive && has_negative);
+}
+
+#ifdef FIGURE_KERNELS_AVX2
+
+// Координаты вершины v восьми фигур (шаг между фигурами - n точек) в виде двух половин по 4 double
+struct Lanes {
+    __m256d lo;
+    __m256d hi;
+};
+
+__attribute__((target("avx2")))
+inline Lanes load_lanes(const float* base, __m256i offsets) {
+    __m256 values = _mm256_i32gather_ps(base, offsets, 4);
+    return {_mm256_cvtps_pd(_mm256_castps256_ps128(values)), _mm256_cvtps_pd(_mm256_extractf128_ps(values, 1))};
+}
+
+// Смещения координаты x вершины 0 восьми фигур подряд
+__attribute__((target("avx2")))
+inline __m256i figure_offsets(size_t n) {
+    int stride = static_cast<int>(2 * n);
+    return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+}
+
+__attribute__((target("avx2")))
+inline void areas_avx2(const Point<float>* verts, size_t n, size_t count, double* out) {
+    const __m256i offsets = figure_offsets(n);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+
+    size_t f = 0;
+    for (; f + 8 <= count; f += 8) {
+        const float* base = reinterpret_cast<const float*>(verts + f * n);
+        __m256d sum1[2] = {_mm256_setzero_pd(), _mm256_setzero_pd()};
+        __m256d sum2[2] = {_mm256_setzero_pd(), _mm256_setzero_pd()};
+        const Lanes x0 = load_lanes(base, offsets);
+        const Lanes y0 = load_lanes(base + 1, offsets);
+        Lanes x = x0;
+        Lanes y = y0;
+        for (size_t v = 1; v <= n; ++v) {
+            Lanes nx = v < n ? load_lanes(base + 2 * v, offsets) : x0;
+            Lanes ny = v < n ? load_lanes(base + 2 * v + 1, offsets) : y0;
+            sum1[0] = _mm256_add_pd(sum1[0], _mm256_mul_pd(x.lo, ny.lo));
+            sum1[1] = _mm256_add_pd(sum1[1], _mm256_mul_pd(x.hi, ny.hi));
+            sum2[0] = _mm256_add_pd(sum2[0], _mm256_mul_pd(y.lo, nx.lo));
+            sum2[1] = _mm256_add_pd(sum2[1], _mm256_mul_pd(y.hi, nx.hi));
+            x = nx;
+            y = ny;
+        }
+        for (int h = 0; h < 2; ++h) {
+            __m256d S = _mm256_mul_pd(half, _mm256_andnot_pd(sign, _mm256_sub_pd(sum1[h], sum2[h])));
+            _mm256_storeu_pd(out + f + 4 * h, S);
+        }
+    }
+    for (; f < count; ++f) out[f] = area_of(verts + f * n, n);
+}
+
+__attribute__((target("avx2")))
+inline void centers_avx2(const Point<float>* verts, size_t n, size_t count, Point<float>* out) {
+    const __m256i offsets = figure_offsets(n);
+    const __m256d count_n = _mm256_set1_pd(static_cast<double>(n));
+
+    size_t f = 0;
+    for (; f + 8 <= count; f += 8) {
+        const float* base = reinterpret_cast<const float*>(verts + f * n);
+        Lanes sx = {_mm256_setzero_pd(), _mm256_setzero_pd()};
+        Lanes sy = sx;
+        for (size_t v = 0; v < n; ++v) {
+            Lanes x = load_lanes(base + 2 * v, offsets);
+            Lanes y = load_lanes(base + 2 * v + 1, offsets);
+            sx = {_mm256_add_pd(sx.lo, x.lo), _mm256_add_pd(sx.hi, x.hi)};
+            sy = {_mm256_add_pd(sy.lo, y.lo), _mm256_add_pd(sy.hi, y.hi)};
+        }
+        // Центры восьми фигур через (x, y) подряд
+        __m256 cx = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_div_pd(sx.hi, count_n)), _mm256_cvtpd_ps(_mm256_div_pd(sx.lo, count_n)));
+        __m256 cy = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_div_pd(sy.hi, count_n)), _mm256_cvtpd_ps(_mm256_div_pd(sy.lo, count_n)));
+        __m256 lo = _mm256_unpacklo_ps(cx, cy);
+        __m256 hi = _mm256_unpackhi_ps(cx, cy);
+        float* dst = reinterpret_cast<float*>(out + f);
+        _mm256_storeu_ps(dst, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    for (; f < count; ++f) out[f] = center_of(verts + f * n, n);
+}
+
+__attribute__((target("avx2")))
+inline void convex_avx2(const Point<float>* verts, size_t n, size_t count, bool* out) {
+    const __m256i offsets = figure_offsets(n);
+    const __m256d zero = _mm256_setzero_pd();
+
+    size_t f = 0;
+    if (n >= 3) {
+        for (; f + 8 <= count; f += 8) {
+            const float* base = reinterpret_cast<const float*>(verts + f * n);
+            __m256d positive[2] = {zero, zero};
+            __m256d negative[2] = {zero, zero};
+            Lanes ax = load_lanes(base, offsets), ay = load_lanes(base + 1, offsets);
+            Lanes bx = load_lanes(base + 2, offsets), by = load_lanes(base + 3, offsets);
+            for (size_t i = 0; i < n; ++i) {
+                size_t k = (i + 2) % n;
+                Lanes cx = load_lanes(base + 2 * k, offsets), cy = load_lanes(base + 2 * k + 1, offsets);
+                const __m256d* a[2][2] = {{&ax.lo, &ay.lo}, {&ax.hi, &ay.hi}};
+                const __m256d* b[2][2] = {{&bx.lo, &by.lo}, {&bx.hi, &by.hi}};
+                const __m256d* c[2][2] = {{&cx.lo, &cy.lo}, {&cx.hi, &cy.hi}};
+                for (int h = 0; h < 2; ++h) {
+                    __m256d cross = _mm256_sub_pd(
+                        _mm256_mul_pd(_mm256_sub_pd(*b[h][0], *a[h][0]), _mm256_sub_pd(*c[h][1], *a[h][1])),
+                        _mm256_mul_pd(_mm256_sub_pd(*b[h][1], *a[h][1]), _mm256_sub_pd(*c[h][0], *a[h][0])));
+                    positive[h] = _mm256_or_pd(positive[h], _mm256_cmp_pd(cross, zero, _CMP_GT_OQ));
+                    negative[h] = _mm256_or_pd(negative[h], _mm256_cmp_pd(cross, zero, _CMP_LT_OQ));
+                }
+                ax = bx, ay = by;
+                bx = cx, by = cy;
+            }
+            int bad = _mm256_movemask_pd(_mm256_and_pd(positive[0], negative[0])) |
+                      (_mm256_movemask_pd(_mm256_and_pd(positive[1], negative[1])) << 4);
+            for (int lane = 0; lane < 8; ++lane) out[f + lane] = !(bad >> lane & 1);
+        }
+    }
+    for (; f < count; ++f) out[f] = convex_of(verts + f * n, n);
+}
+
+// Целые координаты: вершина v восьми фигур в виде двух половин по 4 int64
+struct IntLanes {
+    __m256i lo;
+    __m256i hi;
+};
+
+__attribute__((target("avx2")))
+inline IntLanes load_int_lanes(const int32_t* base, __m256i offsets) {
+    __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), offsets, 4);
+    return {_mm256_cvtepi32_epi64(_mm256_castsi256_si128(values)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(values, 1))};
+}
+
+// Все значения по модулю меньше 2^24: произведения разностей меньше 2^50, суммы помещаются в int64
+__attribute__((target("avx2")))
+inline bool small_coordinates(const int32_t* values, size_t len) {
+    __m256i high = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        high = _mm256_or_si256(high, _mm256_abs_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i))));
+    }
+    bool small = _mm256_testz_si256(high, _mm256_set1_epi32(static_cast<int>(0xFF000000u)));
+    for (; i < len; ++i) {
+        uint32_t magnitude = values[i] < 0 ? 0u - static_cast<uint32_t>(values[i]) : static_cast<uint32_t>(values[i]);
+        small &= magnitude < (1u << 24);
+    }
+    return small;
+}
+
+// Восемь фигур подряд, начиная с first, можно считать в int64
+__attribute__((target("avx2")))
+inline bool small_group(const Point<int32_t>* verts, size_t n, size_t first) {
+    return small_coordinates(reinterpret_cast<const int32_t*>(verts + first * n), 16 * n);
+}
+
+__attribute__((target("avx2")))
+inline void areas_avx2(const Point<int32_t>* verts, size_t n, size_t count, double* out) {
+    const __m256i offsets = figure_offsets(n);
+
+    size_t f = 0;
+    for (; f + 8 <= count; f += 8) {
+        if (!small_group(verts, n, f)) {
+            for (size_t k = f; k < f + 8; ++k) out[k] = area_of(verts + k * n, n);
+            continue;
+        }
+        const int32_t* base = reinterpret_cast<const int32_t*>(verts + f * n);
+        __m256i sum[2] = {_mm256_setzero_si256(), _mm256_setzero_si256()};
+        const IntLanes x0 = load_int_lanes(base, offsets);
+        const IntLanes y0 = load_int_lanes(base + 1, offsets);
+        IntLanes x = x0;
+        IntLanes y = y0;
+        for (size_t v = 1; v <= n; ++v) {
+            IntLanes nx = v < n ? load_int_lanes(base + 2 * v, offsets) : x0;
+            IntLanes ny = v < n ? load_int_lanes(base + 2 * v + 1, offsets) : y0;
+            sum[0] = _mm256_add_epi64(sum[0], _mm256_sub_epi64(_mm256_mul_epi32(x.lo, ny.lo), _mm256_mul_epi32(y.lo, nx.lo)));
+            sum[1] = _mm256_add_epi64(sum[1], _mm256_sub_epi64(_mm256_mul_epi32(x.hi, ny.hi), _mm256_mul_epi32(y.hi, nx.hi)));
+            x = nx;
+            y = ny;
+        }
+        // Удвоенные площади точные, в double переводятся так же, как в area_of
+        alignas(32) int64_t twice[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(twice), sum[0]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(twice + 4), sum[1]);
+        for (int lane = 0; lane < 8; ++lane) {
+            out[f + lane] = 0.5 * static_cast<double>(twice[lane] < 0 ? -twice[lane] : twice[lane]);
+        }
+    }
+    for (; f < count; ++f) out[f] = area_of(verts + f * n, n);
+}
+
+__attribute__((target("avx2")))
+inline void convex_avx2(const Point<int32_t>* verts, size_t n, size_t count, bool* out) {
+    const __m256i offsets = figure_offsets(n);
+    const __m256i zero = _mm256_setzero_si256();
+
+    size_t f = 0;
+    if (n >= 3) {
+        for (; f + 8 <= count; f += 8) {
+            if (!small_group(verts, n, f)) {
+                for (size_t k = f; k < f + 8; ++k) out[k] = convex_of(verts + k * n, n);
+                continue;
+            }
+            const int32_t* base = reinterpret_cast<const int32_t*>(verts + f * n);
+            __m256i positive[2] = {zero, zero};
+            __m256i negative[2] = {zero, zero};
+            IntLanes ax = load_int_lanes(base, offsets), ay = load_int_lanes(base + 1, offsets);
+            IntLanes bx = load_int_lanes(base + 2, offsets), by = load_int_lanes(base + 3, offsets);
+            for (size_t i = 0; i < n; ++i) {
+                size_t k = (i + 2) % n;
+                IntLanes cx = load_int_lanes(base + 2 * k, offsets), cy = load_int_lanes(base + 2 * k + 1, offsets);
+                const __m256i* a[2][2] = {{&ax.lo, &ay.lo}, {&ax.hi, &ay.hi}};
+                const __m256i* b[2][2] = {{&bx.lo, &by.lo}, {&bx.hi, &by.hi}};
+                const __m256i* c[2][2] = {{&cx.lo, &cy.lo}, {&cx.hi, &cy.hi}};
+                for (int h = 0; h < 2; ++h) {
+                    __m256i cross = _mm256_sub_epi64(
+                        _mm256_mul_epi32(_mm256_sub_epi64(*b[h][0], *a[h][0]), _mm256_sub_epi64(*c[h][1], *a[h][1])),
+                        _mm256_mul_epi32(_mm256_sub_epi64(*b[h][1], *a[h][1]), _mm256_sub_epi64(*c[h][0], *a[h][0])));
+                    positive[h] = _mm256_or_si256(positive[h], _mm256_cmpgt_epi64(cross, zero));
+                    negative[h] = _mm256_or_si256(negative[h], _mm256_cmpgt_epi64(zero, cross));
+                }
+                ax = bx, ay = by;
+                bx = cx, by = cy;
+            }
+            int bad = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_and_si256(positive[0], negative[0]))) |
+                      (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_and_si256(positive[1], negative[1]))) << 4);
+            for (int lane = 0; lane < 8; ++lane) out[f + lane] = !(bad >> lane & 1);
+        }
+    }
+    for (; f < count; ++f) out[f] = convex_of(verts + f * n, n);
+}
+
+#endif
+
+// Выбор реализации по возможностям процессора
+inline bool has_avx2() {
+#ifdef FIGURE_KERNELS_AVX2
+    static const bool result = __builtin_cpu_supports("avx2");
+    return result;
+#else
+    return false;
+#endif
+}
+
+} // namespace figure_kernels_detail
+
+// Наибольшее число вершин фигуры для целочисленной версии batch_areas на AVX2
+inline constexpr size_t INT_KERNEL_MAX_VERTICES = size_t{1} << 14;
+
+// Площади фигур
+template <typename T>
+void batch_areas(const Point<T>* verts, size_t n, size_t count, double* out) {
+#ifdef FIGURE_KERNELS_AVX2
+    if constexpr (std::same_as<T, float>) {
+        if (n > 0 && figure_kernels_detail::has_avx2()) return figure_kernels_detail::areas_avx2(verts, n, count, out);
+    }
+    if constexpr (std::same_as<T, int32_t>) {
+        // Суммы n произведений меньше 2^49 помещаются в int64
+        if (n > 0 && n <= INT_KERNEL_MAX_VERTICES && figure_kernels_detail::has_avx2()) {
+            return figure_kernels_detail::areas_avx2(verts, n, count, out);
+        }
+    }
+#endif
+    for (size_t f = 0; f < count; ++f) out[f] = figure_kernels_detail::area_of(verts + f * n, n);
+}
+
+// Центры фигур
+template <typename T>
+void batch_centers(const Point<T>* verts, size_t n, size_t count, Point<T>* out) {
+#ifdef FIGURE_KERNELS_AVX2
+    if constexpr (std::same_as<T, float>) {
+        if (n > 0 && figure_kernels_detail::has_avx2()) return figure_kernels_detail::centers_avx2(verts, n, count, out);
+    }
+#endif
+    for (size_t f = 0; f < count; ++f) out[f] = figure_kernels_detail::center_of(verts + f * n, n);
+}
+
+// Выпуклость фигур
+template <typename T>
+void batch_convex(const Point<T>* verts, size_t n, size_t count, bool* out) {
+#ifdef FIGURE_KERNELS_AVX2
+    if constexpr (std::same_as<T, float>) {
+        if (figure_kernels_detail::has_avx2()) return figure_kernels_detail::convex_avx2(verts, n, count, out);
+    }
+    if constexpr (std::same_as<T, int32_t>) {
+        if (figure_kernels_detail::has_avx2()) return figure_kernels_detail::convex_avx2(verts, n, count, out);
+    }
+#endif
+    for (size_t f = 0; f < count; ++f) out[f] = figure_kernels_detail::convex_of(verts + f * n, n);
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "point.hpp"
+#include "figure_kernels.hpp"
+#include "static_figure.hpp"
+#include "vertex_order.hpp"
+
+// Фигура с числом вершин N, известным при компиляции.
+// Вершины хранятся внутри объекта в std::array, поэтому копирование - это memcpy без выделения памяти,
+// а площадь, центр и выпуклость разворачиваются при компиляции и доступны в constexpr.
+// Виртуальных функций нет: интерфейс дает StaticFigure, конкретные фигуры (FixedTrapezoid, FixedRhombus,
+// FixedPentagon) передают себя в Derived и проверяют вершины в своих конструкторах.
+// Формулы и порядок операций те же, что в Figure<T>, результаты совпадают бит в бит;
+// для целых координат вычисления точные (WideInt, см. figure_kernels.hpp).
+template <typename T, size_t N, typename Derived = void> requires Number<T>
+class FixedFigure : public StaticFigure<std::conditional_t<std::is_void_v<Derived>, FixedFigure<T, N, Derived>, Derived>, T> {
+public:
+    static_assert(N >= 3, "Figure needs at least 3 vertices");
+
+    static constexpr size_t VERTICES = N;
+
+    // Конструкторы (без проверок)
+    constexpr FixedFigure() = default;
+
+    constexpr explicit FixedFigure(const std::array<Point<T>, N>& verts) : vertices(verts) {}
+
+    // Сортировка вершин по порядку обхода
+    void sortVertices() {
+        order_vertices_around_mean(vertices.data(), N);
+    }
+
+    // Вершины фигуры
+    constexpr const std::array<Point<T>, N>& get_vertices() const { return vertices; }
+
+    // Реализации для StaticFigure, развернутые по N
+    constexpr Point<T> center_impl() const { return center_unrolled(std::make_index_sequence<N>()); }
+    constexpr bool convex_impl() const { return convex_unrolled(std::make_index_sequence<N>()); }
+    constexpr double area_impl() const { return area_unrolled(std::make_index_sequence<N>()); }
+
+    // Удвоенная площадь без округлений (для целых координат)
+    constexpr auto twice_area() const requires std::integral<T> {
+        return twice_area_unrolled(std::make_index_sequence<N>());
+    }
+
+protected:
+    std::array<Point<T>, N> vertices{};
+
+private:
+    static constexpr double wide(T value) { return static_cast<double>(value); }
+
+    static constexpr auto exact(T value) requires std::integral<T> { return static_cast<WideInt<T>>(value); }
+
+    template <size_t... I>
+    constexpr auto twice_area_unrolled(std::index_sequence<I...>) const requires std::integral<T> {
+        WideInt<T> sum = (WideInt<T>{0} + ... + (exact(vertices[I].x) * exact(vertices[(I + 1) % N].y) -
+                                                 exact(vertices[I].y) * exact(vertices[(I + 1) % N].x)));
+        return sum < 0 ? -sum : sum;
+    }
+
+    template <size_t... I>
+    constexpr double area_unrolled(std::index_sequence<I...>) const {
+        if constexpr (std::integral<T>) {
+            return 0.5 * static_cast<double>(twice_area_unrolled(std::index_sequence<I...>()));
+        }
+        // Левая свертка складывает слагаемые в том же порядке, что цикл в Figure<T>
+        double sum1 = (0.0 + ... + (wide(vertices[I].x) * wide(vertices[(I + 1) % N].y)));
+        double sum2 = (0.0 + ... + (wide(vertices[I].y) * wide(vertices[(I + 1) % N].x)));
+        double S = 0.5 * (sum1 - sum2);
+        return S < 0 ? -S : S;
+    }
+
+    template <size_t... I>
+    constexpr Point<T> center_unrolled(std::index_sequence<I...>) const {
+        if constexpr (std::integral<T>) {
+            SumInt<T> exact_x = (SumInt<T>{0} + ... + static_cast<SumInt<T>>(vertices[I].x));
+            SumInt<T> exact_y = (SumInt<T>{0} + ... + static_cast<SumInt<T>>(vertices[I].y));
+            return {rounded_quotient<T>(exact_x, N), rounded_quotient<T>(exact_y, N)};
+        }
+        double sum_x = (0.0 + ... + wide(vertices[I].x));
+        double sum_y = (0.0 + ... + wide(vertices[I].y));
+        return {from_double<T>(sum_x / static_cast<double>(N)), from_double<T>(sum_y / static_cast<double>(N))};
+    }
+
+    // Поворот в тройке вершин (i, i + 1, i + 2): 1 - налево, 2 - направо, 0 - коллинеарны
+    constexpr int turn(size_t i) const {
+        const Point<T>& a = vertices[i];
+        const Point<T>& b = vertices[(i + 1) % N];
+        const Point<T>& c = vertices[(i + 2) % N];
+        if constexpr (std::integral<T>) {
+            WideInt<T> exact_cross = cross_exact(a, b, c);
+            return (exact_cross > 0) | ((exact_cross < 0) << 1);
+        }
+        double cross = (wide(b.x) - wide(a.x)) * (wide(c.y) - wide(a.y)) - (wide(b.y) - wide(a.y)) * (wide(c.x) - wide(a.x));
+        return (cross > 0) | ((cross < 0) << 1);
+    }
+
+    template <size_t... I>
+    constexpr bool convex_unrolled(std::index_sequence<I...>) const {
+        return (0 | ... | turn(I)) != 3;
+    }
+};
@@ -4,6 +4,31 @@
 #include <memory>
 #include "point.hpp"
 #include "figure.hpp"
+#include "fixed_figure.hpp"
+
+// Проверка вершин правильного пятиугольника
+template <typename T>
+bool is_pentagon(const Point<T>* vertices) {
+    if constexpr (std::integral<T>) {
+        // Для целых координат стороны сравниваются точно, по квадратам длин
+        WideInt<T> side = squared_distance(vertices[0], vertices[1]);
+        for (size_t i = 1; i < 5; ++i) {
+            if (squared_distance(vertices[i], vertices[(i + 1) % 5]) != side) return false;
+        }
+        return true;
+    }
+    auto distance = [](const Point<T>& a, const Point<T>& b) {
+        double dx = static_cast<double>(a.x) - static_cast<double>(b.x);
+        double dy = static_cast<double>(a.y) - static_cast<double>(b.y);
+        return sqrt(dx * dx + dy * dy);
+    };
+    double side = distance(vertices[0], vertices[1]);
+    for (size_t i = 1; i < 5; ++i) {
+        double s = distance(vertices[i], vertices[(i + 1) % 5]);
+        if (fabs(s - side) > 1e-3) return false;
+    }
+    return true;
+}
 
 template <typename T>
 class Pentagon : public Figure<T> {
@@ -127,16 +152,29 @@ bool Pentagon<T>::equals(const Figure<T>& other) const {
 
 template <typename T>
 bool Pentagon<T>::isPentagon() const {
-    if (this->vertices_num != 5) return false;
-    auto distance = [](const Point<T>& a, const Point<T>& b) {
-        double dx = static_cast<double>(a.x) - static_cast<double>(b.x);
-        double dy = static_cast<double>(a.y) - static_cast<double>(b.y);
-        return sqrt(dx * dx + dy * dy);
-    };
-    double side = distance(this->vertices[0], this->vertices[1]);
-    for (size_t i = 1; i < 5; ++i) {
-        double s = distance(this->vertices[i], this->vertices[(i + 1) % 5]);
-        if (fabs(s - side) > 1e-3) return false;
-    }
-    return true;
+    return this->vertices_num == PENTAGON_VERTICES && is_pentagon(this->vertices.get());
 }
+
+// Пятиугольник с вершинами внутри объекта: копируется без выделения памяти, геометрия через StaticFigure
+template <typename T>
+class FixedPentagon : public FixedFigure<T, 5, FixedPentagon<T>> {
+public:
+    // Конструкторы
+    constexpr FixedPentagon() = default;
+
+    explicit FixedPentagon(const std::array<Point<T>, 5>& verts) : FixedFigure<T, 5, FixedPentagon<T>>(verts) {
+        if (!this->isConvex()) {
+            throw std::invalid_argument("Figure is not convex");
+        }
+        if (!isPentagon()) {
+            throw std::invalid_argument("Points do not form a regular pentagon");
+        }
+        this->sortVertices();
+    }
+
+    // Тип фигуры
+    static constexpr std::string_view NAME = "pentagon";
+
+    // Проверка вершин
+    bool isPentagon() const { return is_pentagon(this->vertices.data()); }
+};
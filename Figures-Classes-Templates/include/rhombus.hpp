@@ -4,6 +4,28 @@
 #include <memory>
 #include "point.hpp"
 #include "figure.hpp"
+#include "fixed_figure.hpp"
+
+// Проверка вершин ромба
+template <typename T>
+bool is_rhombus(const Point<T>* vertices) {
+    if constexpr (std::integral<T>) {
+        // Для целых координат стороны сравниваются точно, по квадратам длин
+        WideInt<T> side = squared_distance(vertices[0], vertices[1]);
+        return squared_distance(vertices[1], vertices[2]) == side && squared_distance(vertices[2], vertices[3]) == side &&
+               squared_distance(vertices[3], vertices[0]) == side;
+    }
+    auto distance = [](const Point<T>& a, const Point<T>& b) {
+        double dx = static_cast<double>(a.x) - static_cast<double>(b.x);
+        double dy = static_cast<double>(a.y) - static_cast<double>(b.y);
+        return sqrt(dx * dx + dy * dy);
+    };
+    double side1 = distance(vertices[0], vertices[1]);
+    double side2 = distance(vertices[1], vertices[2]);
+    double side3 = distance(vertices[2], vertices[3]);
+    double side4 = distance(vertices[3], vertices[0]);
+    return fabs(side1 - side2) < 1e-6 && fabs(side2 - side3) < 1e-6 && fabs(side3 - side4) < 1e-6;
+}
 
 template <typename T>
 class Rhombus : public Figure<T> {
@@ -127,15 +149,29 @@ bool Rhombus<T>::equals(const Figure<T>& other) const {
 
 template <typename T>
 bool Rhombus<T>::isRhombus() const {
-    if (this->vertices_num != 4) return false;
-    auto distance = [](const Point<T>& a, const Point<T>& b) {
-        double dx = static_cast<double>(a.x) - static_cast<double>(b.x);
-        double dy = static_cast<double>(a.y) - static_cast<double>(b.y);
-        return sqrt(dx * dx + dy * dy);
-    };
-    double side1 = distance(this->vertices[0], this->vertices[1]);
-    double side2 = distance(this->vertices[1], this->vertices[2]);
-    double side3 = distance(this->vertices[2], this->vertices[3]);
-    double side4 = distance(this->vertices[3], this->vertices[0]);
-    return fabs(side1 - side2) < 1e-6 && fabs(side2 - side3) < 1e-6 && fabs(side3 - side4) < 1e-6;
+    return this->vertices_num == RHOMBUS_VERTICES && is_rhombus(this->vertices.get());
 }
+
+// Ромб с вершинами внутри объекта: копируется без выделения памяти, геометрия через StaticFigure
+template <typename T>
+class FixedRhombus : public FixedFigure<T, 4, FixedRhombus<T>> {
+public:
+    // Конструкторы
+    constexpr FixedRhombus() = default;
+
+    explicit FixedRhombus(const std::array<Point<T>, 4>& verts) : FixedFigure<T, 4, FixedRhombus<T>>(verts) {
+        if (!this->isConvex()) {
+            throw std::invalid_argument("Figure is not convex");
+        }
+        if (!isRhombus()) {
+            throw std::invalid_argument("Points do not form a rhombus");
+        }
+        this->sortVertices();
+    }
+
+    // Тип фигуры
+    static constexpr std::string_view NAME = "rhombus";
+
+    // Проверка вершин
+    bool isRhombus() const { return is_rhombus(this->vertices.data()); }
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "point.hpp"
+
+// Статический полиморфизм (CRTP): общий интерфейс фигур без виртуальных функций.
+// StaticFigure<Derived, T> вызывает реализации наследника - area_impl, center_impl, convex_impl
+// и get_vertices; наследник задает название типа в Derived::NAME. Вызовы известны при компиляции
+// и встраиваются, поэтому циклы по массивам однотипных фигур не содержат косвенных переходов.
+// Наследник может заменить любую реализацию, объявив функцию с тем же именем.
+template <typename Derived, typename T> requires Number<T>
+class StaticFigure {
+public:
+    // Геометрический центр (центроид)
+    constexpr Point<T> center() const { return self().center_impl(); }
+
+    // Проверка на выпуклость
+    constexpr bool isConvex() const { return self().convex_impl(); }
+
+    // Площадь
+    constexpr double area() const { return self().area_impl(); }
+
+    // Площадь через приведение к double
+    constexpr explicit operator double() const { return area(); }
+
+    // Тип фигуры
+    std::string type() const { return std::string(Derived::NAME); }
+
+    // Количество вершин
+    constexpr size_t get_vertices_num() const { return self().get_vertices().size(); }
+
+    // Проверка на равенство
+    constexpr bool equals(const Derived& other) const { return self().get_vertices() == other.get_vertices(); }
+
+    friend std::ostream& operator<<(std::ostream& out, const StaticFigure& f) {
+        for (const auto& p : f.self().get_vertices()) {
+            out << p << " ";
+        }
+        return out;
+    }
+
+protected:
+    constexpr const Derived& self() const { return static_cast<const Derived&>(*this); }
+};
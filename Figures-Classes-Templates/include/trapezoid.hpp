@@ -4,6 +4,22 @@
 #include <memory>
 #include "point.hpp"
 #include "figure.hpp"
+#include "fixed_figure.hpp"
+
+// Проверка вершин трапеции, вписанной в круг
+template <typename T>
+bool is_trapezoid(const Point<T>* vertices) {
+    auto distance = [](const Point<T>& a, const Point<T>& b) {
+        double dx = static_cast<double>(a.x) - static_cast<double>(b.x);
+        double dy = static_cast<double>(a.y) - static_cast<double>(b.y);
+        return sqrt(dx * dx + dy * dy);
+    };
+    double side1 = distance(vertices[0], vertices[1]);
+    double side2 = distance(vertices[1], vertices[2]);
+    double side3 = distance(vertices[2], vertices[3]);
+    double side4 = distance(vertices[3], vertices[0]);
+    return fabs((side1 + side3) - (side2 + side4)) < 1.0;
+}
 
 template <typename T>
 class Trapezoid : public Figure<T> {
@@ -128,15 +144,29 @@ bool Trapezoid<T>::equals(const Figure<T>& other) const {
 
 template <typename T>
 bool Trapezoid<T>::isTrapezoid() const {
-    if (this->vertices_num != 4) return false;
-    auto distance = [](const Point<T>& a, const Point<T>& b) {
-        double dx = static_cast<double>(a.x) - static_cast<double>(b.x);
-        double dy = static_cast<double>(a.y) - static_cast<double>(b.y);
-        return sqrt(dx * dx + dy * dy);
-    };
-    double side1 = distance(this->vertices[0], this->vertices[1]);
-    double side2 = distance(this->vertices[1], this->vertices[2]);
-    double side3 = distance(this->vertices[2], this->vertices[3]);
-    double side4 = distance(this->vertices[3], this->vertices[0]);
-    return fabs((side1 + side3) - (side2 + side4)) < 1.0;
+    return this->vertices_num == TRAPEZOID_VERTICES && is_trapezoid(this->vertices.get());
 }
+
+// Трапеция с вершинами внутри объекта: копируется без выделения памяти, геометрия через StaticFigure
+template <typename T>
+class FixedTrapezoid : public FixedFigure<T, 4, FixedTrapezoid<T>> {
+public:
+    // Конструкторы
+    constexpr FixedTrapezoid() = default;
+
+    explicit FixedTrapezoid(const std::array<Point<T>, 4>& verts) : FixedFigure<T, 4, FixedTrapezoid<T>>(verts) {
+        if (!this->isConvex()) {
+            throw std::invalid_argument("Figure is not convex");
+        }
+        if (!isTrapezoid()) {
+            throw std::invalid_argument("Points do not form a trapezoid inscribed in a circle");
+        }
+        this->sortVertices();
+    }
+
+    // Тип фигуры
+    static constexpr std::string_view NAME = "trapezoid";
+
+    // Проверка вершин
+    bool isTrapezoid() const { return is_trapezoid(this->vertices.data()); }
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+#include "point.hpp"
+#include "figure_kernels.hpp"
+
+// Упорядочивание вершин по обходу вокруг центра без тригонометрии.
+// Для каждой вершины один раз вычисляется псевдоугол - монотонная функция atan2(dy, dx),
+// после чего вершины сортируются по нему: сетями сортировки для 3, 4, 5 и 8 вершин,
+// вставками или std::sort для остальных. Порядок тот же, что при сравнении atan2.
+
+// Псевдоугол направления (dx, dy): растет вместе с atan2(dy, dx) и лежит в [-2, 2]
+inline double pseudo_angle(double dx, double dy) {
+    double sum = fabs(dx) + fabs(dy);
+    if (sum == 0) return 0.0;
+    double r = dx / sum;
+    // Нижняя полуплоскость (включая -0, как у atan2) - углы от -π до 0
+    return std::signbit(dy) ? r - 1.0 : 1.0 - r;
+}
+
+namespace vertex_order_detail {
+
+// Вершины, для которых вместо сетей сортировки используется std::sort
+constexpr size_t SMALL = 16;
+
+// Упорядочивание пары (i, j) по ключу без ветвлений
+template <typename P>
+inline void exchange(double* key, P* p, size_t i, size_t j) {
+    bool swap = key[j] < key[i];
+    double ki = key[i];
+    double kj = key[j];
+    P pi = p[i];
+    P pj = p[j];
+    key[i] = swap ? kj : ki;
+    key[j] = swap ? ki : kj;
+    p[i] = swap ? pj : pi;
+    p[j] = swap ? pi : pj;
+}
+
+// Сети сортировки: пары сравниваемых позиций
+constexpr size_t NETWORK3[][2] = {{0, 2}, {0, 1}, {1, 2}};
+constexpr size_t NETWORK4[][2] = {{0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}};
+constexpr size_t NETWORK5[][2] = {{0, 1}, {3, 4}, {2, 4}, {2, 3}, {0, 3}, {0, 2}, {1, 4}, {1, 3}, {1, 2}};
+constexpr size_t NETWORK8[][2] = {{0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1}, {2, 3},
+                                  {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}};
+
+template <size_t N, typename P>
+inline void apply(const size_t (&network)[N][2], double* key, P* p) {
+    for (const auto& pair : network) exchange(key, p, pair[0], pair[1]);
+}
+
+// Сортировка вершин по готовым ключам
+template <typename P>
+void sort_by_keys(P* verts, double* key, size_t n) {
+    switch (n) {
+        case 3: apply(NETWORK3, key, verts); return;
+        case 4: apply(NETWORK4, key, verts); return;
+        case 5: apply(NETWORK5, key, verts); return;
+        case 8: apply(NETWORK8, key, verts); return;
+        default: break;
+    }
+
+    if (n <= SMALL) {
+        // Вставками
+        for (size_t i = 1; i < n; ++i) {
+            double k = key[i];
+            P p = verts[i];
+            size_t j = i;
+            for (; j > 0 && k < key[j - 1]; --j) {
+                key[j] = key[j - 1];
+                verts[j] = verts[j - 1];
+            }
+            key[j] = k;
+            verts[j] = p;
+        }
+        return;
+    }
+
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return key[a] < key[b]; });
+    std::vector<P> sorted(n);
+    for (size_t i = 0; i < n; ++i) sorted[i] = verts[order[i]];
+    std::copy(sorted.begin(), sorted.end(), verts);
+}
+
+} // namespace vertex_order_detail
+
+namespace vertex_order_detail {
+
+// Буфер ключей: на стеке для малых фигур, иначе в векторе
+template <typename P, typename Key>
+void sort_with_keys(P* verts, size_t n, Key key_of) {
+    double small[SMALL];
+    std::vector<double> large;
+    double* key = small;
+    if (n > SMALL) {
+        large.resize(n);
+        key = large.data();
+    }
+    for (size_t i = 0; i < n; ++i) key[i] = key_of(verts[i]);
+    sort_by_keys(verts, key, n);
+}
+
+} // namespace vertex_order_detail
+
+// Упорядочивание n вершин по возрастанию угла вокруг точки c
+template <typename P>
+void order_vertices(P* verts, size_t n, const P& c) {
+    if (n < 2) return;
+    vertex_order_detail::sort_with_keys(verts, n, [&](const P& v) {
+        return pseudo_angle(static_cast<double>(v.x) - static_cast<double>(c.x),
+                            static_cast<double>(v.y) - static_cast<double>(c.y));
+    });
+}
+
+// Упорядочивание n вершин по углу вокруг их среднего без округления.
+// Округленный до целых центр может попасть на вершину или ребро, и порядок вокруг него
+// перестает быть обходом, поэтому для целых координат направление n * v - sum считается точно
+// в WideInt (псевдоугол от масштаба не зависит), для дробных центр берется в double
+template <typename P>
+void order_vertices_around_mean(P* verts, size_t n) {
+    if (n < 2) return;
+    using Coordinate = decltype(P::x);
+    if constexpr (std::is_integral_v<Coordinate>) {
+        using W = WideInt<Coordinate>;
+        W sum_x = 0;
+        W sum_y = 0;
+        for (size_t i = 0; i < n; ++i) {
+            sum_x += verts[i].x;
+            sum_y += verts[i].y;
+        }
+        W count = static_cast<W>(n);
+        vertex_order_detail::sort_with_keys(verts, n, [&](const P& v) {
+            return pseudo_angle(static_cast<double>(count * v.x - sum_x), static_cast<double>(count * v.y - sum_y));
+        });
+    } else {
+        double sum_x = 0.0;
+        double sum_y = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            sum_x += static_cast<double>(verts[i].x);
+            sum_y += static_cast<double>(verts[i].y);
+        }
+        double cx = sum_x / static_cast<double>(n);
+        double cy = sum_y / static_cast<double>(n);
+        vertex_order_detail::sort_with_keys(verts, n, [&](const P& v) {
+            return pseudo_angle(static_cast<double>(v.x) - cx, static_cast<double>(v.y) - cy);
+        });
+    }
+}
+
+// Пакетное упорядочивание count фигур по n вершин, лежащих подряд в verts
+template <typename P>
+void order_vertices_batch(P* verts, size_t n, size_t count) {
+    for (size_t f = 0; f < count; ++f) {
+        order_vertices_around_mean(verts + f * n, n);
+    }
+}
@@ -1,4 +1,6 @@
 #include "../include/figure.hpp"
+#include "../include/vertex_order.hpp"
+#include "../include/figure_kernels.hpp"
 #include <algorithm>
 
 template <typename T>
@@ -100,54 +102,23 @@ bool Figure<T>::equals(const Figure& other) const {
 // Нахождение центроида
 template <typename T>
 Point<T> Figure<T>::center() const {
-    Point<T> center;
-    for (size_t i = 0; i < this->vertices_num; ++i) {
-        center = center + this->vertices[i];
-    }
-    return center / this->vertices_num;
+    return figure_kernels_detail::center_of(this->vertices.get(), this->vertices_num);
 }
 
 // Сортировка вершин по порядку обхода
 template <typename T>
 void Figure<T>::sortVertices() {
-    Point<T> c = center();
-    std::sort(vertices.get(), vertices.get() + vertices_num, [&](const Point<T>& a, const Point<T>& b) {
-        double angleA = atan2(static_cast<double>(a.y) - static_cast<double>(c.y), static_cast<double>(a.x) - static_cast<double>(c.x));
-        double angleB = atan2(static_cast<double>(b.y) - static_cast<double>(c.y), static_cast<double>(b.x) - static_cast<double>(c.x));
-        return angleA < angleB;
-    });
+    order_vertices(vertices.get(), vertices_num, center());
 }
 
 // Нахождение площади с помощью метода шнурков
 template <typename T>
 Figure<T>::operator double() const {
-    double S = 0;
-    double sum1 = 0;
-    double sum2 = 0;
-    for (size_t i = 0; i < this->vertices_num - 1; ++i) {
-        sum1 += static_cast<double>(this->vertices[i].x) * static_cast<double>(this->vertices[i + 1].y);
-        sum2 += static_cast<double>(this->vertices[i].y) * static_cast<double>(this->vertices[i + 1].x);
-    }
-    sum1 += static_cast<double>(this->vertices[vertices_num - 1].x) * static_cast<double>(this->vertices[0].y);
-    sum2 += static_cast<double>(this->vertices[vertices_num - 1].y) * static_cast<double>(this->vertices[0].x);
-    S = 0.5 * fabs(sum1 - sum2);
-    return S;
+    return figure_kernels_detail::area_of(this->vertices.get(), this->vertices_num);
 }
 
 // Проверка на выпуклость
 template <typename T>
 bool Figure<T>::isConvex() const {
-    if (vertices_num < 3) return true;
-    int sign = 0;
-    for (size_t i = 0; i < vertices_num; ++i) {
-        Point<T> a = vertices[i];
-        Point<T> b = vertices[(i + 1) % vertices_num];
-        Point<T> c = vertices[(i + 2) % vertices_num];
-        double cross = (static_cast<double>(b.x) - static_cast<double>(a.x)) * (static_cast<double>(c.y) - static_cast<double>(a.y)) - (static_cast<double>(b.y) - static_cast<double>(a.y)) * (static_cast<double>(c.x) - static_cast<double>(a.x));
-        if (cross == 0) continue; // коллинеарные точки, пропускаем
-        int current_sign = (cross > 0) ? 1 : -1;
-        if (sign == 0) sign = current_sign;
-        else if (sign != current_sign) return false;
-    }
-    return true;
-}
\ No newline at end of file
+    return figure_kernels_detail::convex_of(this->vertices.get(), this->vertices_num);
+}
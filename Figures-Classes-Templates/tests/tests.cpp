@@ -3,8 +3,13 @@
 #include "../include/rhombus.hpp"
 #include "../include/pentagon.hpp"
 #include "../include/figure_array.hpp"
+#include "../include/vertex_order.hpp"
+#include "../include/figure_kernels.hpp"
+#include "../include/fixed_figure.hpp"
+#include "../include/static_figure.hpp"
 #include <sstream>
 #include <memory>
+#include <random>
 
 // Helper function to create unique_ptr for points
 template <typename T>
@@ -185,6 +190,35 @@ TEST(PointTest, IntToDoubleConversion) {
     EXPECT_NEAR(p.y, 2.0, 1e-6);
 }
 
+TEST(PointTest, FromDoubleRoundsToNearest) {
+    static_assert(from_double<int>(0.49999999999999994) == 0);
+    static_assert(from_double<int>(-0.49999999999999994) == 0);
+    static_assert(from_double<int>(2.5) == 3);
+    static_assert(from_double<int>(-2.5) == -3);
+    static_assert(from_double<long long>(4503599627370497.0) == 4503599627370497LL);
+    static_assert(from_double<long long>(-4503599627370497.0) == -4503599627370497LL);
+    static_assert(from_double<long long>(9007199254740992.0) == 9007199254740992LL);
+
+    volatile double almost_half = 0.49999999999999994;
+    EXPECT_EQ(from_double<int>(almost_half), 0);
+    EXPECT_EQ(from_double<short>(-1.5), -2);
+    EXPECT_EQ(from_double<long long>(4503599627370495.5), 4503599627370496LL);
+}
+
+TEST(PointTest, StoresCoordinateType) {
+    EXPECT_EQ(sizeof(Point<float>), 2 * sizeof(float));
+    EXPECT_EQ(sizeof(Point<int>), 2 * sizeof(int));
+    Point<int> p{3, 4};
+    Point<int> half = p / 2;
+    EXPECT_EQ(half.x, 2); // 1.5 округляется к ближайшему
+    EXPECT_EQ(half.y, 2);
+
+    auto points = make_points<float>({{0, 0}, {2, 1}, {4, 0}, {2, -1}});
+    Rhombus<float> r(std::move(points));
+    EXPECT_FLOAT_EQ(static_cast<double>(r), 4.0);
+    EXPECT_EQ(r.center(), (Point<float>{2, 0}));
+}
+
 // ============== ARRAY TESTS ==============
 TEST(ArrayTest, EmptyArray) {
     Array<Figure<double>*> arr;
@@ -286,6 +320,326 @@ TEST(ArrayTest, ManyFigures) {
     EXPECT_NEAR(total, 20.0, 1e-5);
 }
 
+TEST(ArrayTest, RemovalModes) {
+    Array<Figure<double>*> arr;
+    arr.reserve(6);
+    for (int i = 1; i <= 6; ++i) {
+        auto points = make_points<double>({{0, 0}, {1.0 * i, 0}, {1.0 * i, 1.0 * i}, {0, 1.0 * i}});
+        arr.emplace_back(new Rhombus<double>(std::move(points)));
+    }
+    // Площади 1, 4, 9, 16, 25, 36
+    arr.pop_swap(0);
+    EXPECT_EQ(arr.get_size(), 5);
+    EXPECT_NEAR(static_cast<double>(*arr.get(0)), 36.0, 1e-9);
+    EXPECT_NEAR(arr.total_area(), 90.0, 1e-9);
+
+    // Пометка не сдвигает индексы, сжатие сохраняет порядок оставшихся
+    arr.remove_later(1);
+    EXPECT_TRUE(arr.is_removed(1));
+    EXPECT_THROW(arr.get(1), std::out_of_range);
+    EXPECT_NEAR(static_cast<double>(*arr.get(2)), 9.0, 1e-9);
+    EXPECT_NEAR(arr.total_area(), 86.0, 1e-9);
+    arr.pop_swap(1);
+    EXPECT_EQ(arr.get_removed(), 0);
+    arr.remove_later(3);
+    EXPECT_EQ(arr.compact(), 1);
+    EXPECT_EQ(arr.get_size(), 3);
+    EXPECT_NEAR(static_cast<double>(*arr.get(1)), 25.0, 1e-9);
+    EXPECT_NEAR(static_cast<double>(*arr.get(2)), 9.0, 1e-9);
+
+    // Индексы не сдвигаются, даже когда помечен весь массив; сжатие - только по вызову
+    arr.remove_later(0);
+    EXPECT_FALSE(arr.should_compact());
+    arr.remove_later(2);
+    EXPECT_TRUE(arr.should_compact());
+    EXPECT_EQ(arr.get_size(), 3);
+    EXPECT_NEAR(static_cast<double>(*arr.get(1)), 25.0, 1e-9);
+    arr.remove_later(1);
+    EXPECT_EQ(arr.get_removed(), 3);
+    EXPECT_NEAR(arr.total_area(), 0.0, 1e-9);
+    EXPECT_EQ(arr.compact(), 3);
+    EXPECT_EQ(arr.get_size(), 0);
+    EXPECT_THROW(arr.pop_swap(0), std::out_of_range);
+}
+
+TEST(ArrayTest, EmplaceBackConstructsValues) {
+    Array<Rhombus<double>> arr;
+    arr.emplace_back(make_points<double>({{0, 0}, {1, 1}, {2, 0}, {1, -1}}));
+    Rhombus<double>& r = arr.emplace_back(make_points<double>({{0, 0}, {2, 2}, {4, 0}, {2, -2}}));
+    EXPECT_NEAR(static_cast<double>(r), 8.0, 1e-9);
+    EXPECT_THROW(arr.emplace_back(make_points<double>({{0, 0}, {4, 0}, {3, 3}, {1, 3}})), std::invalid_argument);
+    EXPECT_EQ(arr.get_size(), 2);
+    arr.remove_later(0);
+    Array<Rhombus<double>> copy(arr);
+    EXPECT_EQ(copy.get_size(), 1);
+    EXPECT_NEAR(copy.total_area(), 8.0, 1e-9);
+}
+
+// Ромб с подписью: фигуры с виртуальными функциями массив перемещает по одному
+struct LabeledRhombus : Rhombus<double> {
+    using Rhombus<double>::Rhombus;
+    LabeledRhombus(std::unique_ptr<Point<double>[]> verts, std::string label)
+        : Rhombus<double>(std::move(verts)), label(std::move(label)) {}
+    std::string label;
+};
+
+TEST(ArrayTest, GrowthRelocatesElements) {
+    static_assert(is_trivially_relocatable_v<Figure<double>*>);
+    static_assert(!is_trivially_relocatable_v<Rhombus<double>>);
+    static_assert(is_trivially_relocatable_v<FixedRhombus<float>>);
+    static_assert(!is_trivially_relocatable_v<LabeledRhombus>);
+
+    Array<Rhombus<double>> values;
+    Array<LabeledRhombus> labeled;
+    Array<Figure<double>*> pointers;
+    for (int i = 1; i <= 100; ++i) {
+        double h = 1.0 * i;
+        values.emplace_back(make_points<double>({{0, 0}, {1, h}, {2, 0}, {1, -h}}));
+        labeled.emplace_back(make_points<double>({{0, 0}, {1, h}, {2, 0}, {1, -h}}), std::string(32, 'a' + i % 26));
+        pointers.add(new Rhombus<double>(make_points<double>({{0, 0}, {1, h}, {2, 0}, {1, -h}})));
+    }
+    // Площади 2, 4, ..., 200
+    EXPECT_NEAR(values.total_area(), 10100.0, 1e-6);
+    EXPECT_NEAR(labeled.total_area(), 10100.0, 1e-6);
+    EXPECT_NEAR(pointers.total_area(), 10100.0, 1e-6);
+    EXPECT_EQ(labeled.get(99).label, std::string(32, 'a' + 100 % 26));
+
+    // Элемент самого массива как аргумент: копия создается до роста
+    values.emplace_back(values.get(99));
+    EXPECT_NEAR(static_cast<double>(values.get(100)), 200.0, 1e-9);
+
+    values.pop(0);
+    labeled.pop(0);
+    EXPECT_NEAR(static_cast<double>(values.get(0)), 4.0, 1e-9);
+    EXPECT_EQ(labeled.get(0).label, std::string(32, 'a' + 2));
+
+    Array<LabeledRhombus> copy;
+    copy = labeled;
+    Array<Figure<double>*> moved(std::move(pointers));
+    moved.add(new Rhombus<double>(make_points<double>({{0, 0}, {1, 1}, {2, 0}, {1, -1}})));
+    EXPECT_EQ(copy.get_size(), 99);
+    EXPECT_NEAR(moved.total_area(), 10102.0, 1e-6);
+}
+
+// ============== VERTEX ORDER TESTS ==============
+TEST(VertexOrderTest, MatchesAtan2Order) {
+    std::mt19937_64 rng(5);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (size_t n : {3, 4, 5, 6, 8, 20}) {
+        size_t count = 100;
+        std::vector<Point<double>> verts(n * count);
+        std::vector<Point<double>> expected(n * count);
+        for (size_t f = 0; f < count; ++f) {
+            // Вершины выпуклого многоугольника в случайном порядке
+            Point<double> c;
+            for (size_t i = 0; i < n; ++i) {
+                double angle = 2 * M_PI * unit(rng);
+                verts[f * n + i] = {4 * cos(angle) + f, 3 * sin(angle)};
+                c = c + verts[f * n + i];
+            }
+            c = c / n;
+            std::copy(verts.begin() + f * n, verts.begin() + (f + 1) * n, expected.begin() + f * n);
+            std::sort(expected.begin() + f * n, expected.begin() + (f + 1) * n,
+                      [&](const Point<double>& a, const Point<double>& b) {
+                          return atan2(a.y - c.y, a.x - c.x) < atan2(b.y - c.y, b.x - c.x);
+                      });
+        }
+        order_vertices_batch(verts.data(), n, count);
+        EXPECT_EQ(verts, expected);
+    }
+}
+
+// Целый центр округляется и может совпасть с вершиной: порядок строится вокруг точного среднего
+TEST(VertexOrderTest, IntegerFiguresKeepConvexOrder) {
+    Trapezoid<int> trapezoid(make_points<int>({{1, 1}, {0, 0}, {2, 0}, {2, 1}}));
+    EXPECT_TRUE(trapezoid.isConvex());
+    EXPECT_EQ(static_cast<double>(trapezoid), 1.5);
+
+    FixedTrapezoid<int> fixed({Point<int>{0, 0}, {2, 0}, {2, 1}, {1, 1}});
+    EXPECT_TRUE(fixed.isConvex());
+    EXPECT_EQ(fixed.area(), 1.5);
+
+    // Все четверки точек решетки 4 x 4: принятая трапеция выпукла и совпадает с дробной
+    std::vector<Point<int>> lattice;
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) lattice.push_back({x, y});
+    }
+    size_t accepted = 0;
+    for (const auto& a : lattice) {
+        for (const auto& b : lattice) {
+            for (const auto& c : lattice) {
+                for (const auto& d : lattice) {
+                    std::unique_ptr<Trapezoid<int>> t;
+                    try {
+                        t = std::make_unique<Trapezoid<int>>(make_points<int>({a, b, c, d}));
+                    } catch (const std::invalid_argument&) {
+                        continue;
+                    }
+                    ++accepted;
+                    Trapezoid<double> exact(make_points<double>({{double(a.x), double(a.y)}, {double(b.x), double(b.y)},
+                                                                 {double(c.x), double(c.y)}, {double(d.x), double(d.y)}}));
+                    ASSERT_TRUE(t->isConvex());
+                    ASSERT_EQ(static_cast<double>(*t), static_cast<double>(exact));
+                }
+            }
+        }
+    }
+    EXPECT_GT(accepted, 0);
+}
+
+// ============== FIGURE KERNELS TESTS ==============
+TEST(FigureKernelsTest, FloatMatchesScalar) {
+    std::mt19937_64 rng(11);
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    for (size_t n : {3, 4, 5, 8}) {
+        size_t count = 37;
+        std::vector<Point<float>> verts(n * count);
+        for (auto& p : verts) p = {coord(rng), coord(rng)};
+        // Половина фигур - выпуклые многоугольники
+        for (size_t f = 0; f < count; f += 2) {
+            for (size_t i = 0; i < n; ++i) {
+                float angle = static_cast<float>(2 * M_PI * i / n);
+                verts[f * n + i] = {f + 5 * std::cos(angle), 5 * std::sin(angle)};
+            }
+        }
+
+        std::vector<double> areas(count);
+        std::vector<Point<float>> centers(count);
+        std::unique_ptr<bool[]> convex(new bool[count]);
+        batch_areas(verts.data(), n, count, areas.data());
+        batch_centers(verts.data(), n, count, centers.data());
+        batch_convex(verts.data(), n, count, convex.get());
+        for (size_t f = 0; f < count; ++f) {
+            const Point<float>* v = verts.data() + f * n;
+            EXPECT_EQ(areas[f], figure_kernels_detail::area_of(v, n));
+            EXPECT_EQ(centers[f], figure_kernels_detail::center_of(v, n));
+            EXPECT_EQ(convex[f], figure_kernels_detail::convex_of(v, n));
+            if (f % 2 == 0) {
+                EXPECT_TRUE(convex[f]);
+            }
+        }
+    }
+}
+
+TEST(FigureKernelsTest, IntMatchesScalar) {
+    std::mt19937_64 rng(13);
+    std::uniform_int_distribution<int32_t> coord(-1000, 1000);
+    for (size_t n : {3, 4, 5, 8}) {
+        size_t count = 45;
+        std::vector<Point<int32_t>> verts(n * count);
+        for (auto& p : verts) p = {coord(rng), coord(rng)};
+        // Квадраты и фигуры с большими координатами (считаются без AVX2)
+        for (size_t f = 0; f < count; f += 3) {
+            int32_t side = 1 + static_cast<int32_t>(f);
+            Point<int32_t> corners[4] = {{0, 0}, {side, 0}, {side, side}, {0, side}};
+            for (size_t i = 0; i < n; ++i) verts[f * n + i] = corners[i % 4];
+        }
+        verts[20 * n] = {2000000000, -2000000000};
+
+        std::vector<double> areas(count);
+        std::unique_ptr<bool[]> convex(new bool[count]);
+        batch_areas(verts.data(), n, count, areas.data());
+        batch_convex(verts.data(), n, count, convex.get());
+        for (size_t f = 0; f < count; ++f) {
+            const Point<int32_t>* v = verts.data() + f * n;
+            EXPECT_EQ(areas[f], figure_kernels_detail::area_of(v, n));
+            EXPECT_EQ(convex[f], figure_kernels_detail::convex_of(v, n));
+        }
+    }
+}
+
+TEST(FigureKernelsTest, IntegerGeometryIsExact) {
+    // Почти коллинеарные вершины: в double произведения округляются и поворот направо теряется
+    const long long B = 1LL << 40;
+    FixedFigure<long long, 4> quad({Point<long long>{0, 0}, {B, B + 1}, {2 * B + 1, 2 * B + 3}, {0, 2 * B + 3}});
+    EXPECT_FALSE(quad.isConvex());
+    EXPECT_TRUE(quad.twice_area() == static_cast<__int128>(4) * B * B + 8 * B + 2);
+    EXPECT_FALSE(figure_kernels_detail::convex_of(quad.get_vertices().data(), 4));
+
+    // Стороны B и sqrt(B^2 + 1) отличаются меньше чем на 1e-6, но это не ромб
+    EXPECT_THROW(FixedRhombus<long long>({Point<long long>{0, 0}, {B, 0}, {2 * B, 1}, {B, 1}}), std::invalid_argument);
+    FixedRhombus<long long> rhombus({Point<long long>{0, 0}, {5 * B, 0}, {8 * B, 4 * B}, {3 * B, 4 * B}});
+    EXPECT_EQ(rhombus.center(), (Point<long long>{4 * B, 2 * B}));
+
+    // Центр целой фигуры округляется так же, как from_double
+    FixedFigure<int, 3> triangle({Point<int>{0, 0}, {1, 0}, {0, -2}});
+    EXPECT_EQ(triangle.center(), (Point<int>{0, -1}));
+    static_assert(FixedFigure<int, 3>({Point<int>{0, 0}, {3, 0}, {0, 3}}).twice_area() == 9);
+}
+
+// ============== FIXED FIGURE TESTS ==============
+TEST(FixedFigureTest, ConstexprGeometry) {
+    constexpr FixedFigure<int, 4> square({Point<int>{0, 0}, {4, 0}, {4, 4}, {0, 4}});
+    static_assert(square.area() == 16.0);
+    static_assert(square.center() == Point<int>{2, 2});
+    static_assert(square.isConvex());
+    static_assert(!FixedFigure<double, 4>({Point<double>{0, 0}, {4, 0}, {1, 1}, {0, 4}}).isConvex());
+    static_assert(std::is_trivially_copyable_v<FixedRhombus<double>>);
+    static_assert(sizeof(FixedPentagon<float>) == 5 * sizeof(Point<float>));
+}
+
+TEST(FixedFigureTest, MatchesFigure) {
+    std::array<Point<double>, 4> verts = {Point<double>{0, 0}, {1, 0.5}, {2, 0}, {1, -0.5}};
+    FixedRhombus<double> fixed(verts);
+    Rhombus<double> rhombus(make_points<double>({verts[0], verts[1], verts[2], verts[3]}));
+    EXPECT_EQ(static_cast<double>(fixed), static_cast<double>(rhombus));
+    EXPECT_EQ(fixed.center(), rhombus.center());
+    EXPECT_EQ(fixed.type(), rhombus.type());
+    std::ostringstream out1, out2;
+    out1 << fixed;
+    out2 << rhombus;
+    EXPECT_EQ(out1.str(), out2.str());
+
+    EXPECT_THROW(FixedRhombus<double>({Point<double>{0, 0}, {3, 0}, {3, 1}, {0, 1}}), std::invalid_argument);
+    EXPECT_THROW(FixedTrapezoid<double>({Point<double>{0, 0}, {4, 0}, {1, 1}, {0, 4}}), std::invalid_argument);
+
+    // Массив значений без указателей
+    Array<FixedRhombus<double>> arr;
+    for (int i = 0; i < 12; ++i) arr.add(fixed);
+    EXPECT_DOUBLE_EQ(arr.total_area(), 12 * static_cast<double>(rhombus));
+}
+
+// ============== STATIC FIGURE TESTS ==============
+// Наследник заменяет площадь своей формулой (через диагонали)
+struct DiagonalRhombus : FixedFigure<double, 4, DiagonalRhombus> {
+    static constexpr std::string_view NAME = "diagonal";
+    using FixedFigure::FixedFigure;
+    constexpr double area_impl() const {
+        double d1 = vertices[2].x - vertices[0].x;
+        double d2 = vertices[1].y - vertices[3].y;
+        return d1 * d2 / 2 + 1000; // отличается от метода шнурков, чтобы было видно, какая формула вызвана
+    }
+};
+
+TEST(StaticFigureTest, DerivedImplementationsAreUsed) {
+    constexpr DiagonalRhombus r({Point<double>{0, 0}, {2, 1}, {4, 0}, {2, -1}});
+    static_assert(r.area() == 1004.0);
+    static_assert(static_cast<double>(r) == 1004.0);
+    static_assert(r.center() == Point<double>{2, 0});
+    EXPECT_EQ(r.type(), "diagonal");
+    EXPECT_EQ(FixedRhombus<double>({Point<double>{0, 0}, {2, 1}, {4, 0}, {2, -1}}).area(), 4.0);
+}
+
+TEST(StaticFigureTest, ValueArraysMatchPointers) {
+    Array<Figure<double>*> pointers;
+    Array<Rhombus<double>> values;
+    Array<FixedRhombus<double>> fixed;
+    for (int i = 0; i < 25; ++i) {
+        double h = 1 + i % 4;
+        std::array<Point<double>, 4> verts = {Point<double>{0, 0}, {2, h}, {4, 0}, {2, -h}};
+        pointers.add(new Rhombus<double>(make_points<double>({verts[0], verts[1], verts[2], verts[3]})));
+        values.add(Rhombus<double>(make_points<double>({verts[0], verts[1], verts[2], verts[3]})));
+        fixed.add(FixedRhombus<double>(verts));
+    }
+    EXPECT_EQ(values.total_area(), pointers.total_area());
+    EXPECT_EQ(fixed.total_area(), pointers.total_area());
+
+    std::ostringstream out1, out2;
+    out1 << values;
+    out2 << pointers;
+    EXPECT_EQ(out1.str(), out2.str());
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
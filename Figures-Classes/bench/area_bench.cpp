@@ -0,0 +1,105 @@
+#include "../include/figure_variant.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+// Сравнение общей площади массива фигур при хранении указателей, колонок и значений std::variant,
+// а также копирования FigureArray (clone каждой фигуры) и FigureValueArray.
+// Массив заполняется случайными треугольниками, квадратами и 8-угольниками.
+//
+// Использование: area_bench [число фигур] [повторы]
+
+namespace {
+
+// Правильный многоугольник из n вершин с центром (cx, cy)
+void regular(Point* verts, size_t n, double cx, double cy, double r, double phase) {
+    for (size_t i = 0; i < n; ++i) {
+        double angle = phase + 2 * M_PI * i / n;
+        verts[i] = {cx + r * cos(angle), cy + r * sin(angle)};
+    }
+}
+
+// Лучшее время из repeats запусков op в миллисекундах
+template <typename Op>
+double best_ms(size_t repeats, Op op) {
+    double best = 1e300;
+    for (size_t r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        op();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ms);
+    }
+    return best;
+}
+
+// Замер полного пересчета площади
+template <typename Array>
+void run(const char* name, const Array& arr, size_t repeats) {
+    double area = 0.0;
+    double best = best_ms(repeats, [&] {
+        if constexpr (std::is_same_v<Array, FigureArray>) {
+            area = arr.compute_total_area();
+        } else {
+            area = arr.total_area();
+        }
+    });
+    std::cout << name << ": " << best << " ms (" << best * 1e6 / arr.get_size() << " ns/figure), area " << area << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5;
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> radius(0.5, 10.0);
+    std::uniform_int_distribution<int> side(1, 20);
+
+    FigureArray arr(count);
+    for (size_t i = 0; i < count; ++i) {
+        double cx = coord(rng);
+        double cy = coord(rng);
+        Point verts[8];
+        switch (i % 3) {
+            case 0:
+                regular(verts, 3, cx, cy, radius(rng), coord(rng));
+                arr.add(*new Triangle(verts));
+                break;
+            case 1: {
+                // Целые координаты, чтобы стороны квадрата совпадали точно
+                double x = std::round(cx);
+                double y = std::round(cy);
+                double s = side(rng);
+                verts[0] = {x, y};
+                verts[1] = {x + s, y};
+                verts[2] = {x + s, y + s};
+                verts[3] = {x, y + s};
+                arr.add(*new Square(verts));
+                break;
+            }
+            default:
+                regular(verts, 8, cx, cy, radius(rng), coord(rng));
+                arr.add(*new Octagon(verts));
+                break;
+        }
+    }
+    std::cout << "Figures: " << count << std::endl;
+
+    FigureValueArray values(arr);
+    run("pointers", arr, repeats);
+    run("variant ", values, repeats);
+    arr.set_storage(FigureArray::Storage::Columns);
+    run("columns ", arr, repeats);
+    arr.set_storage(FigureArray::Storage::Pointers);
+
+    size_t copied = 0;
+    double ms = best_ms(repeats, [&] { FigureArray copy(arr); copied += copy.get_size(); });
+    std::cout << "copy pointers: " << ms << " ms" << std::endl;
+    ms = best_ms(repeats, [&] { FigureValueArray copy(values); copied += copy.get_size(); });
+    std::cout << "copy variant : " << ms << " ms" << std::endl;
+
+    return 0;
+}
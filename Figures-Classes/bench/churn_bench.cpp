@@ -0,0 +1,74 @@
+#include "../include/figure_array.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Вставка и удаление фигур при выделении памяти из кучи (new Square(...)) и из пула массива
+// (emplace). Массив заполняется count фигурами, затем rounds раз удаляется и добавляется заново
+// churn фигур около конца массива, затем массив уничтожается.
+//
+// Использование: churn_bench [число фигур] [повторы] [фигур за повтор]
+
+namespace {
+
+double ms_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Вершины фигур трех видов
+Point TRIANGLE[3] = {{0, 0}, {4, 0}, {0, 3}};
+Point SQUARE[4] = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+Point OCTAGON[8] = {{0, 1}, {1, 2}, {2, 2}, {3, 1}, {3, 0}, {2, -1}, {1, -1}, {0, 0}};
+
+// Добавление фигуры вида kind из кучи или из пула
+void add_figure(FigureArray& arr, unsigned kind, bool pooled) {
+    switch (kind) {
+        case 0:
+            if (pooled) arr.emplace<Triangle>(TRIANGLE); else arr.add(*new Triangle(TRIANGLE));
+            break;
+        case 1:
+            if (pooled) arr.emplace<Square>(SQUARE); else arr.add(*new Square(SQUARE));
+            break;
+        default:
+            if (pooled) arr.emplace<Octagon>(OCTAGON); else arr.add(*new Octagon(OCTAGON));
+            break;
+    }
+}
+
+void run(const char* name, bool pooled, size_t count, size_t rounds, size_t churn) {
+    std::mt19937 rng(42);
+    auto start = std::chrono::steady_clock::now();
+    double fill = 0.0, cycle = 0.0;
+    {
+        FigureArray arr(count);
+        for (size_t i = 0; i < count; ++i) add_figure(arr, rng() % 3, pooled);
+        fill = ms_since(start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; ++r) {
+            for (size_t i = 0; i < churn; ++i) arr.pop(arr.get_size() - 1 - rng() % 64);
+            for (size_t i = 0; i < churn; ++i) add_figure(arr, rng() % 3, pooled);
+        }
+        cycle = ms_since(start);
+        start = std::chrono::steady_clock::now();
+    }
+    double destroy = ms_since(start);
+
+    std::cout << name << ": fill " << fill << " ms (" << fill * 1e6 / count << " ns/figure), churn "
+              << cycle << " ms (" << cycle * 1e6 / (2 * rounds * churn) << " ns/op), destroy " << destroy << " ms"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t rounds = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20;
+    size_t churn = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 100000;
+    churn = std::min(churn, count > 64 ? count - 64 : size_t(0));
+    std::cout << "Figures: " << count << ", rounds: " << rounds << ", churn: " << churn << std::endl;
+
+    run("heap", false, count, rounds, churn);
+    run("pool", true, count, rounds, churn);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include "../include/convex_hull.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+// Выпуклая оболочка случайных точек в круге: convex_hull и parallel_convex_hull по потокам.
+//
+// Использование: hull_bench [число точек] [максимум потоков]
+
+namespace {
+
+double ms_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4;
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> radius(0.0, 1.0);
+    std::uniform_real_distribution<double> angle(0.0, 2 * M_PI);
+    std::vector<Point> points(count);
+    for (auto& p : points) {
+        double r = std::sqrt(radius(rng));
+        double a = angle(rng);
+        p = {r * cos(a), r * sin(a)};
+    }
+    std::cout << "Points: " << count << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Point> hull = convex_hull(points);
+    std::cout << "convex_hull: " << ms_since(start) << " ms, " << hull.size() << " vertices" << std::endl;
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        start = std::chrono::steady_clock::now();
+        std::vector<Point> parallel = parallel_convex_hull(points, threads);
+        std::cout << "parallel_convex_hull, " << threads << " threads: " << ms_since(start) << " ms"
+                  << (parallel == hull ? "" : ", MISMATCH") << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "../include/figure_loader.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <thread>
+
+// Загрузка файла фигур через FigureArray::read и через load_figures с разным числом потоков.
+//
+// Использование: load_bench [число фигур] [максимум потоков] [файл]
+
+namespace {
+
+// Запись случайных фигур в файл в формате ввода
+void generate(const std::string& path, size_t count) {
+    std::ofstream out(path);
+    out.precision(17);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> radius(0.5, 10.0);
+    for (size_t i = 0; i < count; ++i) {
+        double cx = coord(rng);
+        double cy = coord(rng);
+        if (i % 3 == 1) {
+            // Целые координаты, чтобы стороны квадрата совпадали точно
+            long x = std::lround(cx);
+            long y = std::lround(cy);
+            long s = 1 + static_cast<long>(rng() % 20);
+            out << "square " << x << ' ' << y << ' ' << x + s << ' ' << y << ' '
+                << x + s << ' ' << y + s << ' ' << x << ' ' << y + s << '\n';
+            continue;
+        }
+        size_t n = i % 3 == 0 ? 3 : 8;
+        double r = radius(rng);
+        double phase = coord(rng);
+        out << (n == 3 ? "triangle" : "octagon");
+        for (size_t v = 0; v < n; ++v) {
+            double angle = phase + 2 * M_PI * v / n;
+            out << ' ' << cx + r * cos(angle) << ' ' << cy + r * sin(angle);
+        }
+        out << '\n';
+    }
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t maxThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+    std::string path = argc > 3 ? argv[3] : "figures_bench.txt";
+
+    generate(path, count);
+    std::ifstream probe(path, std::ios::ate);
+    double megabytes = static_cast<double>(probe.tellg()) / (1 << 20);
+    std::cout << "Figures: " << count << ", file: " << megabytes << " MiB" << std::endl;
+
+    {
+        FigureArray arr;
+        std::ifstream in(path);
+        auto start = std::chrono::steady_clock::now();
+        in >> arr;
+        double s = seconds_since(start);
+        std::cout << "FigureArray::read    : " << s << " s, " << megabytes / s << " MiB/s, "
+                  << arr.get_size() << " figures" << std::endl;
+    }
+
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        FigureArray arr;
+        auto start = std::chrono::steady_clock::now();
+        load_figures(arr, path, threads);
+        double s = seconds_since(start);
+        std::printf("load_figures %2zu thr : %g s, %g MiB/s, %zu figures\n", threads, s, megabytes / s, arr.get_size());
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "../include/figure_array.hpp"
+#include "../include/vertex_order.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Упорядочивание вершин: std::sort со сравнением atan2 (прежний Figure::sortVertices),
+// order_vertices по псевдоуглам и пакетный order_vertices_batch, а также создание 8-угольников.
+//
+// Использование: order_bench [число фигур] [потоки]
+
+namespace {
+
+double ms_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+Point mean(const Point* verts, size_t n) {
+    Point c;
+    for (size_t i = 0; i < n; ++i) c = c + verts[i];
+    return c / n;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4;
+
+    // Вершины правильных многоугольников в случайном порядке
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    for (size_t n : {3, 4, 5, 8}) {
+        std::vector<Point> source(n * count);
+        for (size_t f = 0; f < count; ++f) {
+            double cx = coord(rng);
+            double cy = coord(rng);
+            for (size_t i = 0; i < n; ++i) {
+                double angle = 2 * M_PI * i / n + 0.1;
+                source[f * n + i] = {cx + 3 * cos(angle), cy + 3 * sin(angle)};
+            }
+            std::shuffle(source.begin() + f * n, source.begin() + (f + 1) * n, rng);
+        }
+
+        std::vector<Point> verts = source;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t f = 0; f < count; ++f) {
+            Point* figure = verts.data() + f * n;
+            Point c = mean(figure, n);
+            std::sort(figure, figure + n, [&](const Point& a, const Point& b) {
+                return atan2(a.y - c.y, a.x - c.x) < atan2(b.y - c.y, b.x - c.x);
+            });
+        }
+        double atan2_ms = ms_since(start);
+        std::vector<Point> expected = verts;
+
+        verts = source;
+        start = std::chrono::steady_clock::now();
+        for (size_t f = 0; f < count; ++f) {
+            Point* figure = verts.data() + f * n;
+            order_vertices(figure, n, mean(figure, n));
+        }
+        double single_ms = ms_since(start);
+        bool same = verts == expected;
+
+        verts = source;
+        start = std::chrono::steady_clock::now();
+        order_vertices_batch(verts.data(), n, count, threads);
+        double batch_ms = ms_since(start);
+        same = same && verts == expected;
+
+        std::cout << n << " vertices: atan2 " << atan2_ms * 1e6 / count << " ns/figure, pseudo-angle "
+                  << single_ms * 1e6 / count << " ns/figure, batch (" << threads << " threads) "
+                  << batch_ms * 1e6 / count << " ns/figure" << (same ? "" : ", ORDER MISMATCH") << std::endl;
+    }
+
+    // Создание фигур: конструктор упорядочивает вершины
+    std::vector<Point> octagons(8 * count);
+    for (size_t f = 0; f < count; ++f) {
+        for (size_t i = 0; i < 8; ++i) {
+            double angle = 2 * M_PI * i / 8 + 0.1;
+            octagons[f * 8 + i] = {3 * cos(angle) + f, 3 * sin(angle)};
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    {
+        FigureArray arr(count);
+        for (size_t f = 0; f < count; ++f) arr.emplace<Octagon>(octagons.data() + f * 8);
+    }
+    std::cout << "Octagon construction: " << ms_since(start) * 1e6 / count << " ns/figure" << std::endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "../include/overlap.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Поиск пересекающихся пар фигур: sweep and prune с отсечением и масштабирование по потокам.
+// Для небольших массивов результат сверяется с перебором всех пар.
+//
+// Использование: overlap_bench [число фигур] [максимум потоков]
+
+namespace {
+
+double ms_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4;
+
+    // Квадраты и треугольники размером 1..4 в квадрате [0, 1000], координаты кратны 1/4
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> coord(0, 4000);
+    std::uniform_int_distribution<int> side(4, 16);
+    FigureArray arr(count);
+    for (size_t i = 0; i < count; ++i) {
+        double x = coord(rng) * 0.25;
+        double y = coord(rng) * 0.25;
+        double s = side(rng) * 0.25;
+        if (i % 2 == 0) {
+            Point points[4] = {{x, y}, {x + s, y}, {x + s, y + s}, {x, y + s}};
+            arr.add(*new Square(points));
+        } else {
+            Point points[3] = {{x, y}, {x + s, y + s / 2}, {x, y + s}};
+            arr.add(*new Triangle(points));
+        }
+    }
+    std::cout << "Figures: " << count << std::endl;
+
+    std::vector<FigureOverlap> base;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<FigureOverlap> pairs = find_overlaps(arr, threads);
+        double ms = ms_since(start);
+        double area = 0.0;
+        for (const auto& p : pairs) area += p.area;
+        std::cout << "threads " << threads << ": " << ms << " ms, " << pairs.size() << " pairs, area " << area
+                  << std::endl;
+        if (threads == 1) {
+            base = pairs;
+        } else if (pairs.size() != base.size()) {
+            std::cout << "MISMATCH" << std::endl;
+            return 1;
+        }
+    }
+
+    if (count <= 20000) {
+        auto start = std::chrono::steady_clock::now();
+        size_t found = 0;
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t j = i + 1; j < count; ++j) {
+                found += intersection_area(arr.get(i), arr.get(j)) > 0;
+            }
+        }
+        std::cout << "all pairs: " << ms_since(start) << " ms, " << found << " pairs" << std::endl;
+        if (found != base.size()) {
+            std::cout << "MISMATCH" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include "../include/point_query.hpp"
+#include "../include/rtree.hpp"
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Поиск фигур, содержащих точку: перебор массива, R-дерево и пакетный PointQueryEngine.
+//
+// Использование: query_bench [число фигур] [число запросов] [число точек пакета]
+
+namespace {
+
+double ms_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t queries = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+    size_t batch = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 10000000;
+
+    // Квадраты со стороной 1..4 в квадрате [0, 2000]
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> coord(0, 2000);
+    std::uniform_int_distribution<int> side(1, 4);
+    FigureArray arr(count);
+    for (size_t i = 0; i < count; ++i) {
+        double x = coord(rng);
+        double y = coord(rng);
+        double s = side(rng);
+        Point points[4] = {{x, y}, {x + s, y}, {x + s, y + s}, {x, y + s}};
+        arr.add(*new Square(points));
+    }
+    std::vector<Point> points(queries);
+    std::uniform_real_distribution<double> real(0.0, 2000.0);
+    for (auto& p : points) p = {real(rng), real(rng)};
+    std::cout << "Figures: " << count << ", queries: " << queries << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    RTree tree(arr);
+    std::cout << "build (STR): " << ms_since(start) << " ms, height " << tree.get_height() << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (const auto& p : points) {
+        for (size_t i = 0; i < arr.get_size(); ++i) {
+            found += arr.get(i).contains(p);
+        }
+    }
+    double scan = ms_since(start);
+    std::cout << "linear scan: " << scan / queries * 1000 << " us/query, " << found << " hits" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    found = 0;
+    for (const auto& p : points) {
+        found += tree.query_point(p).size();
+    }
+    double indexed = ms_since(start);
+    std::cout << "r-tree     : " << indexed / queries * 1000 << " us/query, " << found << " hits" << std::endl;
+
+    // Пакетный запрос: число попаданий сравнивается на первых queries точках
+    std::vector<Point> many(batch);
+    for (size_t i = 0; i < batch; ++i) many[i] = i < queries ? points[i] : Point{real(rng), real(rng)};
+
+    start = std::chrono::steady_clock::now();
+    PointQueryEngine engine(arr);
+    std::cout << "engine build: " << ms_since(start) << " ms" << std::endl;
+
+    size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        start = std::chrono::steady_clock::now();
+        std::vector<size_t> ids = engine.query(many, threads);
+        double ms = ms_since(start);
+        size_t hits = 0;
+        for (size_t i = 0; i < batch; ++i) hits += ids[i] != PointQueryEngine::NOT_FOUND;
+        std::cout << "engine " << threads << " thr: " << ms / batch * 1e6 << " ns/point, "
+                  << batch / ms / 1000 << " Mpoints/s, " << hits << " points inside" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "../include/figure_array.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+
+// Масштабирование parallel_total_area по числу потоков от 1 до N.
+// Для каждого числа потоков печатается время, ускорение и совпадение результата с однопоточным.
+//
+// Использование: scaling_bench [число фигур] [максимум потоков]
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+    size_t maxThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    // Треугольники разного размера, чтобы порядок сложения влиял на результат
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> size(1e-3, 1e3);
+    FigureArray arr(count);
+    for (size_t i = 0; i < count; ++i) {
+        double x = coord(rng);
+        double y = coord(rng);
+        double s = size(rng);
+        Point verts[3] = {{x, y}, {x + s, y}, {x, y + s}};
+        arr.add(*new Triangle(verts));
+    }
+    std::cout << "Figures: " << count << std::endl;
+
+    double baseTime = 0.0;
+    double baseArea = 0.0;
+    for (size_t threads = 1; threads <= maxThreads; ++threads) {
+        double best = 1e300;
+        double area = 0.0;
+        for (int r = 0; r < 5; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            area = arr.parallel_total_area(threads);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, ms);
+        }
+        if (threads == 1) {
+            baseTime = best;
+            baseArea = area;
+        }
+        bool same = std::memcmp(&area, &baseArea, sizeof(double)) == 0;
+        std::cout << threads << " threads: " << best << " ms, speedup " << baseTime / best
+                  << ", area " << area << (same ? " (identical)" : " (DIFFERENT)") << std::endl;
+    }
+
+    return 0;
+}
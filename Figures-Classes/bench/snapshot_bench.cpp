@@ -0,0 +1,112 @@
+#include "../include/figure_snapshot.hpp"
+#include "../include/figure_loader.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <thread>
+
+// Сохранение и загрузка массива фигур в текстовом виде (FigureArray::write, load_figures)
+// и двоичным снимком (save_snapshot, load_snapshot).
+//
+// Использование: snapshot_bench [число фигур] [потоки текстовой загрузки]
+
+namespace {
+
+// Правильный многоугольник из n вершин с центром (cx, cy)
+void regular(Point* verts, size_t n, double cx, double cy, double r, double phase) {
+    for (size_t i = 0; i < n; ++i) {
+        double angle = phase + 2 * M_PI * i / n;
+        verts[i] = {cx + r * cos(angle), cy + r * sin(angle)};
+    }
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double megabytes_of(const std::string& path) {
+    std::ifstream probe(path, std::ios::ate | std::ios::binary);
+    return static_cast<double>(probe.tellg()) / (1 << 20);
+}
+
+void report(const char* name, double s, double megabytes, size_t figures) {
+    std::printf("%-14s: %g s, %g MiB/s, %zu figures\n", name, s, megabytes / s, figures);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+    std::string text_path = "snapshot_bench.txt";
+    std::string binary_path = "snapshot_bench.bin";
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> radius(0.5, 10.0);
+    std::uniform_int_distribution<int> side(1, 20);
+
+    FigureArray arr(count);
+    for (size_t i = 0; i < count; ++i) {
+        double cx = coord(rng);
+        double cy = coord(rng);
+        Point verts[8];
+        switch (i % 3) {
+            case 0:
+                regular(verts, 3, cx, cy, radius(rng), coord(rng));
+                arr.emplace<Triangle>(verts);
+                break;
+            case 1: {
+                // Целые координаты, чтобы стороны квадрата совпадали точно
+                double x = std::round(cx);
+                double y = std::round(cy);
+                double s = side(rng);
+                verts[0] = {x, y};
+                verts[1] = {x + s, y};
+                verts[2] = {x + s, y + s};
+                verts[3] = {x, y + s};
+                arr.emplace<Square>(verts);
+                break;
+            }
+            default:
+                regular(verts, 8, cx, cy, radius(rng), coord(rng));
+                arr.emplace<Octagon>(verts);
+                break;
+        }
+    }
+    std::cout << "Figures: " << count << std::endl;
+
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::ofstream out(text_path);
+        out.precision(17);
+        out << arr;
+        out.close();
+        report("text write", seconds_since(start), megabytes_of(text_path), arr.get_size());
+    }
+    {
+        FigureArray loaded;
+        auto start = std::chrono::steady_clock::now();
+        load_figures(loaded, text_path, threads);
+        report("text load", seconds_since(start), megabytes_of(text_path), loaded.get_size());
+    }
+    {
+        auto start = std::chrono::steady_clock::now();
+        save_snapshot(arr, binary_path);
+        report("snapshot save", seconds_since(start), megabytes_of(binary_path), arr.get_size());
+    }
+    {
+        FigureArray loaded;
+        auto start = std::chrono::steady_clock::now();
+        load_snapshot(loaded, binary_path);
+        report("snapshot load", seconds_since(start), megabytes_of(binary_path), loaded.get_size());
+        std::printf("total area: %.17g / %.17g\n", loaded.total_area(), arr.total_area());
+    }
+
+    std::remove(text_path.c_str());
+    std::remove(binary_path.c_str());
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "../include/figure_array.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+// Аффинные преобразования всего массива фигур: сдвиг (порядок вершин сохраняется),
+// поворот (вершины упорядочиваются заново), преобразование только треугольников
+// и хранение по столбцам. Для сравнения - пересчет общей площади по всем фигурам.
+//
+// Использование: transform_bench [число фигур] [максимум потоков]
+
+namespace {
+
+// Правильный многоугольник из n вершин с центром (cx, cy)
+void regular(Point* verts, size_t n, double cx, double cy, double r, double phase) {
+    for (size_t i = 0; i < n; ++i) {
+        double angle = phase + 2 * M_PI * i / n;
+        verts[i] = {cx + r * cos(angle), cy + r * sin(angle)};
+    }
+}
+
+double ms_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Op>
+void run(const char* name, size_t count, Op op) {
+    auto start = std::chrono::steady_clock::now();
+    op();
+    double ms = ms_since(start);
+    std::printf("%-28s: %8.2f ms (%.1f ns/figure)\n", name, ms, ms * 1e6 / count);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t maxThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> radius(0.5, 10.0);
+    std::uniform_int_distribution<int> side(1, 20);
+
+    FigureArray arr(count);
+    for (size_t i = 0; i < count; ++i) {
+        double cx = coord(rng);
+        double cy = coord(rng);
+        Point verts[8];
+        switch (i % 3) {
+            case 0:
+                regular(verts, 3, cx, cy, radius(rng), coord(rng));
+                arr.emplace<Triangle>(verts);
+                break;
+            case 1: {
+                double x = std::round(cx);
+                double y = std::round(cy);
+                double s = side(rng);
+                verts[0] = {x, y};
+                verts[1] = {x + s, y};
+                verts[2] = {x + s, y + s};
+                verts[3] = {x, y + s};
+                arr.emplace<Square>(verts);
+                break;
+            }
+            default:
+                regular(verts, 8, cx, cy, radius(rng), coord(rng));
+                arr.emplace<Octagon>(verts);
+                break;
+        }
+    }
+    std::cout << "Figures: " << count << std::endl;
+
+    double area = 0.0;
+    run("compute_total_area", count, [&] { area = arr.compute_total_area(); });
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        std::string name = "translation, " + std::to_string(threads) + " threads";
+        run(name.c_str(), count, [&] { arr.transform(AffineTransform::translation(1.5, -2.5), threads); });
+    }
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        std::string name = "rotation, " + std::to_string(threads) + " threads";
+        run(name.c_str(), count, [&] { arr.transform(AffineTransform::rotation(0.3) * AffineTransform::scaling(1.1, 1.1), threads); });
+    }
+    run("scaling of triangles", count, [&] { arr.transform(AffineTransform::scaling(2, 0.5), "triangle"); });
+    arr.set_storage(FigureArray::Storage::Columns);
+    run("translation, columns", count, [&] { arr.transform(AffineTransform::translation(-1.5, 2.5)); });
+
+    std::printf("total area: %.17g (tracked) / %.17g (recomputed)\n", arr.total_area(), arr.compute_total_area());
+    return 0;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include "point.hpp"
+
+// Аффинное преобразование плоскости (матрица 2x3):
+// x' = a * x + b * y + tx
+// y' = c * x + d * y + ty
+struct AffineTransform {
+    double a = 1.0, b = 0.0, tx = 0.0;
+    double c = 0.0, d = 1.0, ty = 0.0;
+
+    // Сдвиг на (dx, dy)
+    static AffineTransform translation(double dx, double dy) {
+        return {1.0, 0.0, dx, 0.0, 1.0, dy};
+    }
+
+    // Поворот на angle радиан против часовой стрелки вокруг точки center
+    static AffineTransform rotation(double angle, const Point& center = Point()) {
+        double cs = cos(angle);
+        double sn = sin(angle);
+        return {cs, -sn, center.x - cs * center.x + sn * center.y,
+                sn, cs, center.y - sn * center.x - cs * center.y};
+    }
+
+    // Растяжение в sx раз по x и в sy раз по y относительно точки center
+    static AffineTransform scaling(double sx, double sy, const Point& center = Point()) {
+        return {sx, 0.0, center.x - sx * center.x, 0.0, sy, center.y - sy * center.y};
+    }
+
+    // Образ точки
+    Point apply(const Point& p) const {
+        return {a * p.x + b * p.y + tx, c * p.x + d * p.y + ty};
+    }
+
+    // Композиция: сначала other, затем this
+    AffineTransform operator*(const AffineTransform& other) const {
+        return {a * other.a + b * other.c, a * other.b + b * other.d, a * other.tx + b * other.ty + tx,
+                c * other.a + d * other.c, c * other.b + d * other.d, c * other.tx + d * other.ty + ty};
+    }
+
+    // Определитель линейной части: площади фигур умножаются на его модуль
+    double determinant() const {
+        return a * d - b * c;
+    }
+
+    // Подобие (поворот, отражение и равномерное растяжение): квадрат остается квадратом.
+    // Допускается относительная погрешность 1e-12 от композиции нескольких поворотов
+    bool is_similarity() const {
+        double eps = 1e-12 * (fabs(a) + fabs(b) + fabs(c) + fabs(d));
+        return (fabs(a - d) <= eps && fabs(b + c) <= eps) || (fabs(a + d) <= eps && fabs(b - c) <= eps);
+    }
+
+    // Порядок вершин по углу вокруг центра сохраняется (сдвиг и растяжение с положительными коэффициентами)
+    bool preserves_order() const {
+        return b == 0.0 && c == 0.0 && a > 0.0 && d > 0.0;
+    }
+};
+
+// Преобразование n точек, лежащих подряд (AVX2, если процессор его поддерживает)
+void transform_points(Point* points, size_t n, const AffineTransform& m);
+
+// Преобразование n точек, координаты которых лежат в отдельных массивах xs и ys
+void transform_columns(double* xs, double* ys, size_t n, const AffineTransform& m);
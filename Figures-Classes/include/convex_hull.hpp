@@ -0,0 +1,19 @@
+#pragma once
+
+#include <vector>
+#include "point.hpp"
+
+// Выпуклая оболочка множества точек методом монотонной цепочки (Эндрю) за O(n log n).
+// Вершины оболочки идут против часовой стрелки начиная с самой левой (затем нижней) точки,
+// точки на сторонах и повторы в оболочку не входят. Для одной или двух различных точек
+// возвращаются они сами.
+std::vector<Point> convex_hull(std::vector<Point> points);
+
+// Оболочка большого набора: точки внутри многоугольника крайних точек по восьми направлениям
+// отбрасываются, остальные делятся на threads кусков, оболочки кусков строятся параллельно и объединяются.
+// Результат совпадает с convex_hull
+std::vector<Point> parallel_convex_hull(const std::vector<Point>& points, size_t threads);
+
+// Все точки лежат на границе своей выпуклой оболочки (выпуклое положение, порядок не важен).
+// Проверка за O(n h), h - число вершин оболочки; предназначена для небольших фигур
+bool in_convex_position(const Point* points, size_t n);
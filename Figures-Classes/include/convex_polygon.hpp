@@ -0,0 +1,67 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "point.hpp"
+#include "figure.hpp"
+
+// Выпуклый многоугольник с произвольным числом вершин.
+// Строится как выпуклая оболочка любого набора точек за O(n log n)
+class ConvexPolygon : public Figure {
+public:
+    // Число точек при чтении
+    static constexpr size_t MIN_VERTICES = 3;
+    static constexpr size_t MAX_VERTICES = size_t{1} << 20;
+
+    // Конструкторы (без точек - вырожденный треугольник в начале координат, заполняется чтением)
+    ConvexPolygon();
+
+    explicit ConvexPolygon(const std::vector<Point>& points);
+
+    // Конструкторы с массивом вершин из пула
+    explicit ConvexPolygon(FigurePool& pool);
+
+    ConvexPolygon(const std::vector<Point>& points, FigurePool& pool);
+
+    // Конструктор копирования
+    ConvexPolygon(const ConvexPolygon& other);
+
+    // Оператор присваивания копированием
+    ConvexPolygon& operator=(const ConvexPolygon& other);
+
+    // Конструктор перемещения
+    ConvexPolygon(ConvexPolygon&& other) noexcept;
+
+    // Конструктор присваивания перемещением
+    ConvexPolygon& operator=(ConvexPolygon&& other) noexcept;
+
+    // Деструктор
+    virtual ~ConvexPolygon() = default;
+
+    // Геометрический центр (центроид)
+    virtual Point center() const override;
+
+    // Чтение/запись: число точек, затем точки (фигура - их выпуклая оболочка)
+    virtual void read(std::istream& in) override;
+    virtual void write(std::ostream& out) const override;
+
+    // Тип фигуры
+    virtual std::string type() const override { return "polygon"; }
+
+    // Клонирование
+    virtual Figure* clone() const override;
+
+    // Площадь через приведение к double
+    virtual operator double() const override;
+
+    // Проверка на равенство
+    virtual bool equals(const Figure& other) const override;
+
+protected:
+    // Общий конструктор по точкам (pool == nullptr - вершины в куче)
+    ConvexPolygon(const std::vector<Point>& points, FigurePool* pool);
+
+    // Вершины - выпуклая оболочка points (std::invalid_argument, если она вырождена)
+    void build(const std::vector<Point>& points);
+};
@@ -1,11 +1,43 @@
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <cmath>
 #include <stdexcept>
+#include <string>
 #include "point.hpp"
+#include "affine.hpp"
+#include "figure_pool.hpp"
 
+// Ограничивающий прямоугольник со сторонами, параллельными осям
+struct BoundingBox {
+    Point min;
+    Point max;
+
+    // Пересечение с другим прямоугольником (касание считается пересечением)
+    bool overlaps(const BoundingBox& other) const {
+        return min.x <= other.max.x && other.min.x <= max.x && min.y <= other.max.y && other.min.y <= max.y;
+    }
+
+    // Принадлежность точки прямоугольнику
+    bool contains(const Point& p) const {
+        return min.x <= p.x && p.x <= max.x && min.y <= p.y && p.y <= max.y;
+    }
+
+    // Наименьший прямоугольник, содержащий оба
+    BoundingBox merge(const BoundingBox& other) const {
+        return {{std::min(min.x, other.min.x), std::min(min.y, other.min.y)},
+                {std::max(max.x, other.max.x), std::max(max.y, other.max.y)}};
+    }
+
+    // Площадь прямоугольника
+    double area() const {
+        return (max.x - min.x) * (max.y - min.y);
+    }
+};
+
+class FigureArray;
 
 class Figure {
 public:
@@ -17,6 +49,11 @@ public:
 
     Figure(size_t n, Point* verts);
 
+    // Конструкторы с массивом вершин из пула (nullptr - из кучи)
+    Figure(size_t n, FigurePool* pool);
+
+    Figure(size_t n, Point* verts, FigurePool* pool);
+
     // Конструктор копирования
     Figure(const Figure& other);
 
@@ -32,10 +69,17 @@ public:
     // Деструктор
     virtual ~Figure();
 
+    // Выделение памяти под фигуру: new Square(...) берет ее из кучи, new (pool) Square(...) - из пула.
+    // delete возвращает память туда, откуда она была взята
+    static void* operator new(size_t size);
+    static void* operator new(size_t size, FigurePool& pool);
+    static void operator delete(void* p);
+    static void operator delete(void* p, FigurePool& pool);
+
     // Геометрический центр (центроид)
     virtual Point center() const;
 
-    // Проверка на выпуклость
+    // Проверка на выпуклость: повороты во всех тройках соседних вершин одного знака (вершины по порядку обхода)
     virtual bool isConvex() const;
 
     // Сортировка вершин по порядку обхода
@@ -54,9 +98,32 @@ public:
     // Площадь через приведение к double
     virtual operator double() const;
 
+    // Ограничивающий прямоугольник
+    BoundingBox bounding_box() const;
+
+    // Принадлежность точки выпуклой фигуре (граница считается внутренней частью)
+    bool contains(const Point& p) const;
+
+    // Пересечение выпуклой фигуры с прямоугольником (теорема о разделяющей оси)
+    bool intersects(const BoundingBox& rect) const;
+
     // Проверка на равенство
     virtual bool equals(const Figure& other) const;
 
+    // Преобразование сохраняет вид фигуры (для любой фигуры - невырожденное)
+    virtual bool can_transform(const AffineTransform& m) const;
+
+    // Аффинное преобразование вершин (std::invalid_argument, если can_transform ложно).
+    // Запомненные площадь и центр пересчитываются без обхода вершин: площадь умножается
+    // на модуль определителя, центр преобразуется как точка
+    void transform(const AffineTransform& m);
+
+    // Количество вершин
+    size_t get_vertices_num() const { return vertices_num; }
+
+    // Вершины фигуры
+    const Point* get_vertices() const { return vertices; }
+
     friend std::ostream& operator<<(std::ostream& out, const Figure& f) {
         f.write(out);
         return out;
@@ -66,7 +133,41 @@ public:
         return in;
     }
 
+    // Загрузка снимка восстанавливает сохраненные вершины без повторной сортировки
+    friend size_t load_snapshot(FigureArray& arr, const std::string& path);
+
 protected:
+    // Пересчет запомненных площади, центра и прямоугольника по вершинам.
+    // Вызывается при любом изменении вершин
+    void update_cache();
+
+    // Замена вершин фигуры на n вершин из verts
+    void assign_vertices(const Point* verts, size_t n);
+
     size_t vertices_num;
     Point* vertices;
+
+private:
+    // Массив вершин из пула или из кучи и его освобождение
+    Point* allocate_vertices(size_t n) const;
+    void free_vertices();
+
+    // Пул, из которого выделен массив вершин (nullptr - куча). Копия фигуры получает вершины
+    // из кучи, при перемещении массив вершин переходит к новой фигуре вместе с пулом
+    FigurePool* pool = nullptr;
+
+    // Вычисления по вершинам
+    double compute_area() const;
+    Point compute_center() const;
+    BoundingBox compute_bounding_box() const;
+
+    // Результаты вычислений по вершинам. Пересчитываются при каждом изменении вершин,
+    // константные методы только читают их, поэтому одну фигуру можно читать из нескольких потоков
+    struct Cache {
+        double area = 0.0;
+        Point center;
+        BoundingBox bbox;
+    };
+
+    Cache cache;
 };
\ No newline at end of file
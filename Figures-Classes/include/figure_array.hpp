@@ -1,15 +1,27 @@
+#pragma once
+
+#include <memory>
 #include "figure.hpp"
+#include "figure_columns.hpp"
+#include "figure_pool.hpp"
 #include "triangle.hpp"
 #include "square.hpp"
 #include "octagon.hpp"
+#include "convex_polygon.hpp"
 
 class FigureArray 
 {
 public:
+    // Способ хранения для вычислений над всем массивом:
+    // Pointers - площади и центры берутся у фигур через виртуальные вызовы,
+    // Columns - дополнительно вершины копируются в колоночное хранилище FigureColumns,
+    // и площади и центры считаются по нему
+    enum class Storage { Pointers, Columns };
+
     // Конструкторы
     FigureArray();
 
-    FigureArray(size_t n);
+    FigureArray(size_t n, Storage storage = Storage::Pointers);
 
     // Конструктор копирования
     FigureArray(const FigureArray& other);
@@ -35,18 +47,76 @@ public:
     // Удаление по индексу
     virtual void pop(size_t index);
 
+    // Создание фигуры типа T в пуле массива и добавление ее в конец
+    template <typename T>
+    T& emplace(Point* verts) {
+        FigurePool& figure_pool = get_pool();
+        T* f = new (figure_pool) T(verts, figure_pool);
+        try {
+            add(*f);
+        } catch (...) {
+            delete f;
+            throw;
+        }
+        return *f;
+    }
+
+    // Пул, из которого массив берет память под свои фигуры и их вершины (emplace, read).
+    // Фигуры из пула можно добавлять только в этот массив
+    FigurePool& get_pool();
+
+    // Аффинное преобразование всех фигур (блоки по PARALLEL_BLOCK фигур распределяются между threads потоками).
+    // Сначала проверяется, что преобразование допустимо для каждой фигуры, иначе std::invalid_argument
+    // и массив не меняется. Общая площадь умножается на модуль определителя без пересчета
+    void transform(const AffineTransform& m, size_t threads = 1);
+
+    // Аффинное преобразование только фигур типа type ("triangle", "square", ...)
+    void transform(const AffineTransform& m, const std::string& type, size_t threads = 1);
+
     // Печатаем геометрический центр (центроид) всех фигур
     virtual void array_center() const;
 
     // Печатаем площадь всех фигур
     virtual void array_square() const;
 
-    // Общая площадь всех фигур
+    // Общая площадь всех фигур (поддерживается при добавлении и удалении, O(1)).
+    // Фигуры, уже лежащие в массиве, не должны изменяться извне
     virtual double total_area() const;
 
+    // Общая площадь, заново посчитанная по всем фигурам
+    double compute_total_area() const;
+
+    // === ПАРАЛЛЕЛЬНЫЕ ВЕРСИИ ===
+    // Массив делится на блоки по PARALLEL_BLOCK фигур, блоки распределяются между threads потоками.
+    // Суммы блоков складываются попарно в фиксированном порядке, поэтому результат
+    // не зависит от числа потоков
+
+    static constexpr size_t PARALLEL_BLOCK = 1024;
+
+    // Общая площадь, посчитанная по всем фигурам
+    double parallel_total_area(size_t threads) const;
+
+    // Печатаем центры всех фигур (вычисляются параллельно, печатаются по порядку)
+    void parallel_array_center(size_t threads) const;
+
+    // Печатаем площади всех фигур (вычисляются параллельно, печатаются по порядку)
+    void parallel_array_square(size_t threads) const;
+
     // Получить размер
     size_t get_size() const { return size; }
 
+    // Фигура по индексу
+    const Figure& get(size_t index) const {
+        if (index >= size) throw std::out_of_range("Index out of range");
+        return *array[index];
+    }
+
+    // Способ хранения
+    Storage get_storage() const { return storage; }
+
+    // Смена способа хранения (колонки строятся по текущим фигурам)
+    void set_storage(Storage new_storage);
+
     // Чтение/запись
     virtual void read(std::istream& in);
     virtual void write(std::ostream& out) const;
@@ -63,4 +133,17 @@ private:
     size_t size;
     size_t capacity;
     Figure** array;
+    Storage storage;
+    FigureColumns columns;  // Заполняется только в режиме Storage::Columns
+    std::unique_ptr<FigurePool> pool;  // Создается при первом обращении, переходит при перемещении массива
+
+    // Сумма площадей с компенсацией ошибки округления
+    double area_sum = 0.0;
+    double area_compensation = 0.0;
+
+    // Изменение суммы площадей на delta
+    void update_area(double delta);
+
+    // Преобразование фигур типа type (nullptr - всех фигур)
+    void transform_figures(const AffineTransform& m, const std::string* type, size_t threads);
 };
\ No newline at end of file
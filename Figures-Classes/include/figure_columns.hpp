@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include "figure.hpp"
+
+// Колоночное хранилище фигур.
+// Фигуры с одинаковым числом вершин (треугольники, квадраты, 8-угольники) собираются в группу,
+// в группе координаты x и y вершины v всех фигур лежат в отдельных непрерывных массивах.
+// Площадь и центр считаются проходом по этим массивам (AVX2, если процессор его поддерживает)
+// без виртуальных вызовов и переходов по указателям на фигуры.
+class FigureColumns {
+public:
+    // Конструктор
+    FigureColumns() = default;
+
+    // Добавление вершин фигуры в конец
+    void add(const Figure& f);
+
+    // Удаление фигуры по индексу (индексы - в порядке добавления)
+    void pop(size_t index);
+
+    // Удаление всех фигур
+    void clear();
+
+    // Аффинное преобразование всех фигур (проходом по столбцам)
+    void transform(const AffineTransform& m);
+
+    // Аффинное преобразование фигуры по индексу
+    void transform(size_t index, const AffineTransform& m);
+
+    // Получить размер
+    size_t get_size() const { return slots.size(); }
+
+    // Площадь фигуры по индексу
+    double area(size_t index) const;
+
+    // Геометрический центр фигуры по индексу
+    Point center(size_t index) const;
+
+    // Площади всех фигур в порядке добавления
+    std::vector<double> areas() const;
+
+    // Центры всех фигур в порядке добавления
+    std::vector<Point> centers() const;
+
+    // Общая площадь всех фигур
+    double total_area() const;
+
+private:
+    // Группа фигур с одинаковым числом вершин
+    struct Group {
+        size_t vertices_num;
+        std::vector<std::vector<double>> xs;  // xs[v][i] - x вершины v фигуры i группы
+        std::vector<std::vector<double>> ys;  // ys[v][i] - y вершины v фигуры i группы
+
+        size_t get_size() const { return xs[0].size(); }
+    };
+
+    // Положение фигуры: группа и номер в группе
+    struct Slot {
+        size_t group;
+        size_t position;
+    };
+
+    std::vector<Group> groups;
+    std::vector<Slot> slots;
+};
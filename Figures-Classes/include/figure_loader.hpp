@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include "figure_array.hpp"
+
+// Быстрая загрузка фигур в формате FigureArray::read: "тип x1 y1 x2 y2 ...".
+// Скобки и запятые считаются разделителями, поэтому принимается и вывод FigureArray::write.
+// Неизвестные слова пропускаются, как в FigureArray::read.
+//
+// Текст делится на threads кусков по границам записей (запись начинается с названия типа),
+// каждый поток разбирает числа через std::from_chars и создает свои фигуры (конструкторы
+// фигур проверяют корректность). Затем фигуры добавляются в массив по порядку.
+// При ошибке в массив не добавляется ничего, исключение описывает первую ошибочную запись.
+
+// Разбор текста, возвращается число добавленных фигур
+size_t parse_figures(FigureArray& arr, std::string_view text, size_t threads = 1);
+
+// Загрузка файла через mmap, возвращается число добавленных фигур
+size_t load_figures(FigureArray& arr, const std::string& path, size_t threads = 1);
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// Пул памяти для фигур и их массивов вершин.
+// Блоки до MAX_BLOCK байт раздаются из страниц по PAGE_SIZE байт, каждая страница нарезана на
+// блоки одного размера (кратного GRANULE). Освобожденный блок попадает в список свободных блоков
+// своего размера и выдается следующему запросу; страницы возвращаются системе только вместе с
+// пулом. Большие блоки берутся из кучи. Пул не потокобезопасен.
+class FigurePool {
+public:
+    static constexpr size_t GRANULE = 16;
+    static constexpr size_t MAX_BLOCK = 512;
+    static constexpr size_t PAGE_SIZE = 64 * 1024;
+
+    // Конструктор
+    FigurePool() = default;
+
+    // Блоки пула принадлежат ему, копирование и перемещение запрещены
+    FigurePool(const FigurePool& other) = delete;
+    FigurePool& operator=(const FigurePool& other) = delete;
+
+    // Деструктор (все выданные блоки к этому моменту должны быть освобождены)
+    ~FigurePool();
+
+    // Выделение блока из bytes байт
+    void* allocate(size_t bytes);
+
+    // Возврат блока, bytes - тот же размер, что при выделении
+    void deallocate(void* p, size_t bytes);
+
+    // Число страниц
+    size_t get_pages() const { return pages.size(); }
+
+    // Число выданных и еще не возвращенных блоков
+    size_t get_used() const { return used; }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // Блоки одного размера: список свободных и неразмеченный остаток текущей страницы
+    struct SizeClass {
+        FreeBlock* free = nullptr;
+        std::byte* next = nullptr;
+        std::byte* end = nullptr;
+    };
+
+    std::array<SizeClass, MAX_BLOCK / GRANULE> classes;
+    std::vector<void*> pages;
+    size_t used = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "figure_array.hpp"
+
+// Двоичный снимок FigureArray.
+//
+// Заголовок (32 байта): "FIGSNAP" и нулевой байт, версия формата, метка порядка байтов 0x01020304,
+// число фигур и общее число вершин. Затем по записи на фигуру: тег типа (uint32), число вершин
+// (uint32) и вершины парами double x, y. Все поля в порядке байтов машины, записи выровнены по 8 байт.
+//
+// Вершины в снимке уже упорядочены конструкторами фигур, поэтому при загрузке они не сортируются.
+// Проверяются структура файла (теги, число вершин, конечность координат) и вид каждой фигуры
+// с сохраненным порядком вершин: порядок обхода (один оборот вокруг центра), выпуклость,
+// ненулевая площадь, isSquare.
+
+static constexpr char SNAPSHOT_MAGIC[8] = {'F', 'I', 'G', 'S', 'N', 'A', 'P', '\0'};
+static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+// Теги типов фигур
+enum class SnapshotTag : uint32_t { Triangle = 1, Square = 2, Octagon = 3, Polygon = 4 };
+
+// Сохранение всех фигур массива в файл (std::runtime_error при ошибке записи)
+void save_snapshot(const FigureArray& arr, const std::string& path);
+
+// Загрузка снимка через mmap с добавлением фигур в конец массива; возвращается число добавленных фигур.
+// Фигуры и их вершины берутся из пула массива. При ошибке в массив не добавляется ничего:
+// std::runtime_error - файл нельзя открыть, std::invalid_argument - файл не является корректным снимком
+size_t load_snapshot(FigureArray& arr, const std::string& path);
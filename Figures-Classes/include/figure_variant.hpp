@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <variant>
+#include <vector>
+#include "figure_array.hpp"
+
+// Фигура-значение: N вершин хранятся внутри объекта, без кучи и виртуальных методов.
+// Порядок вычислений тот же, что в Figure, поэтому площадь и центр совпадают побитово.
+// Проверки выпуклости и квадратности не выполняются - значения получаются из уже
+// проверенных фигур через to_value.
+template <size_t N>
+struct PolygonValue {
+    std::array<Point, N> vertices;
+
+    // Площадь методом шнурков
+    double area() const {
+        double sum1 = 0;
+        double sum2 = 0;
+        for (size_t i = 0; i + 1 < N; ++i) {
+            sum1 += vertices[i].x * vertices[i + 1].y;
+            sum2 += vertices[i].y * vertices[i + 1].x;
+        }
+        sum1 += vertices[N - 1].x * vertices[0].y;
+        sum2 += vertices[N - 1].y * vertices[0].x;
+        return 0.5 * fabs(sum1 - sum2);
+    }
+
+    // Геометрический центр как среднее вершин
+    Point center() const {
+        Point c;
+        for (const auto& v : vertices) c = c + v;
+        return c / N;
+    }
+
+    // Ограничивающий прямоугольник
+    BoundingBox bounding_box() const {
+        BoundingBox box{vertices[0], vertices[0]};
+        for (size_t i = 1; i < N; ++i) {
+            box.min.x = std::min(box.min.x, vertices[i].x);
+            box.min.y = std::min(box.min.y, vertices[i].y);
+            box.max.x = std::max(box.max.x, vertices[i].x);
+            box.max.y = std::max(box.max.y, vertices[i].y);
+        }
+        return box;
+    }
+};
+
+using TriangleValue = PolygonValue<3>;
+using SquareValue = PolygonValue<4>;
+using OctagonValue = PolygonValue<8>;
+
+// Закрытый набор фигур: выбор операции через std::visit вместо виртуального вызова
+using FigureValue = std::variant<TriangleValue, SquareValue, OctagonValue>;
+
+// Копирование массива значений сводится к memcpy
+static_assert(std::is_trivially_copyable_v<FigureValue>);
+
+// Значение по фигуре (std::invalid_argument для типов вне набора)
+FigureValue to_value(const Figure& f);
+
+// Новая фигура по значению (освобождается владельцем, как фигуры FigureArray)
+Figure* to_figure(const FigureValue& value);
+
+inline double area(const FigureValue& value) {
+    return std::visit([](const auto& f) { return f.area(); }, value);
+}
+
+inline Point center(const FigureValue& value) {
+    return std::visit([](const auto& f) { return f.center(); }, value);
+}
+
+inline BoundingBox bounding_box(const FigureValue& value) {
+    return std::visit([](const auto& f) { return f.bounding_box(); }, value);
+}
+
+// Массив фигур-значений: фигуры лежат подряд в одном векторе, копирование не вызывает clone
+class FigureValueArray {
+public:
+    // Конструкторы
+    FigureValueArray() = default;
+
+    explicit FigureValueArray(const FigureArray& arr);
+
+    // Добавление в конец
+    void add(const FigureValue& value);
+    void add(const Figure& f);
+
+    // Удаление по индексу
+    void pop(size_t index);
+
+    // Удаление всех фигур
+    void clear();
+
+    // Резервирование памяти
+    void reserve(size_t n) { figures.reserve(n); }
+
+    // Получить размер
+    size_t get_size() const { return figures.size(); }
+
+    // Фигура по индексу
+    const FigureValue& get(size_t index) const {
+        if (index >= figures.size()) throw std::out_of_range("Index out of range");
+        return figures[index];
+    }
+
+    // Печатаем геометрический центр всех фигур
+    void array_center() const;
+
+    // Печатаем площадь всех фигур
+    void array_square() const;
+
+    // Площади и центры всех фигур
+    std::vector<double> areas() const;
+    std::vector<Point> centers() const;
+
+    // Общая площадь всех фигур
+    double total_area() const;
+
+    // Перенос в FigureArray (новые фигуры)
+    FigureArray to_array() const;
+
+private:
+    std::vector<FigureValue> figures;
+};
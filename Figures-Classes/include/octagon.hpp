@@ -12,6 +12,11 @@ public:
 
     Octagon(Point* verts);
 
+    // Конструкторы с массивом вершин из пула
+    explicit Octagon(FigurePool& pool);
+
+    Octagon(Point* verts, FigurePool& pool);
+
     // Конструктор копирования
     Octagon(const Octagon& other);
 
@@ -47,5 +52,8 @@ public:
     virtual bool equals(const Figure& other) const override;
 
 protected:
+    // Общий конструктор по вершинам (pool == nullptr - вершины в куче)
+    Octagon(Point* verts, FigurePool* pool);
+
     static constexpr size_t OCTAGON_VERTICES = 8;
 };
\ No newline at end of file
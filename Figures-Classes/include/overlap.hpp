@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+#include "figure_array.hpp"
+
+// Пересечения выпуклых фигур массива.
+// Широкая фаза - sweep and prune в горизонтальных полосах: внутри полосы прямоугольники сортируются
+// по левой границе, и каждая фигура сравнивается только с фигурами, начинающимися левее ее правой
+// границы. Узкая фаза - отсечение Сазерленда-Ходжмана одной выпуклой фигуры другой и площадь
+// получившегося многоугольника.
+// Фигуры-кандидаты делятся между потоками на непрерывные куски.
+
+// Пересекающаяся пара фигур: индексы в массиве (first < second) и площадь пересечения
+struct FigureOverlap {
+    size_t first;
+    size_t second;
+    double area;
+};
+
+// Многоугольник пересечения двух выпуклых фигур (пустой, если они не пересекаются)
+std::vector<Point> intersection(const Figure& a, const Figure& b);
+
+// Площадь пересечения двух выпуклых фигур
+double intersection_area(const Figure& a, const Figure& b);
+
+// Все пары фигур с пересечением ненулевой площади (касание не считается), по возрастанию (first, second)
+std::vector<FigureOverlap> find_overlaps(const FigureArray& arr, size_t threads = 1);
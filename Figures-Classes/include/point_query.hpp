@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "figure_array.hpp"
+
+// Пакетная классификация точек по фигурам массива.
+// При построении для каждой фигуры запоминаются ребра (начало и направление, обход приводится
+// к обходу против часовой стрелки), а фигуры раскладываются по ячейкам равномерной сетки.
+// Фигура, накрывающая больше MAX_FIGURE_CELLS ячеек, в сетку не попадает и хранится в отдельном
+// списке больших фигур, который проверяется для каждой точки: так размер сетки остается
+// пропорциональным числу фигур.
+// Ребра фигур лежат в памяти в порядке ячеек, поэтому соседние фигуры оказываются рядом.
+// Точки запроса группируются по ячейкам, и каждая фигура-кандидат проверяется сразу
+// для 4 точек (AVX2, если процессор его поддерживает).
+// Набор точек делится между потоками на непрерывные куски.
+// Движок хранит копию геометрии: после изменения массива его нужно построить заново.
+class PointQueryEngine {
+public:
+    // Результат для точки, не лежащей ни в одной фигуре
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    // Наибольшее число ячеек сетки, в которые раскладывается одна фигура
+    static constexpr size_t MAX_FIGURE_CELLS = 64;
+
+    // Ребро фигуры: начало (ax, ay) и направление (ex, ey)
+    struct Edge {
+        double ax, ay, ex, ey;
+    };
+
+    // Конструкторы
+    PointQueryEngine();
+
+    explicit PointQueryEngine(const FigureArray& arr);
+
+    // Построение по фигурам массива
+    void build(const FigureArray& arr);
+
+    // Количество фигур
+    size_t get_size() const { return figures_num; }
+
+    // Индекс первой фигуры массива, содержащей точку (граница считается внутренней частью), или NOT_FOUND
+    size_t query(const Point& p) const;
+
+    // То же для каждой точки набора
+    std::vector<size_t> query(std::span<const Point> points, size_t threads = 1) const;
+
+private:
+    // Проверка точек [0, n) одного куска, результаты в out
+    void query_range(const Point* points, size_t n, size_t* out) const;
+
+    // Ячейка сетки, в которую попадает точка, или NOT_FOUND
+    size_t cell_of(double x, double y) const;
+
+    // Фигура-кандидат в ячейке: прямоугольник хранится здесь же, чтобы отсев не ходил по памяти
+    struct CellEntry {
+        BoundingBox box;
+        size_t figure;
+        uint32_t edges_begin;
+        uint32_t edges_num;
+    };
+
+    // === ДАННЫЕ-ЧЛЕНЫ ===
+
+    size_t figures_num;
+    std::vector<Edge> edges;             // Ребра всех фигур, фигуры упорядочены по ячейкам
+
+    BoundingBox bounds;                  // Прямоугольник всех фигур
+    size_t grid_size;                    // Сетка grid_size x grid_size ячеек
+    double cell_width;
+    double cell_height;
+    std::vector<size_t> cell_offsets;    // Кандидаты ячейки c: cell_entries[cell_offsets[c] .. cell_offsets[c + 1])
+    std::vector<CellEntry> cell_entries; // Внутри ячейки - по возрастанию индекса фигуры
+
+    // Большие фигуры вне сетки, по возрастанию индекса фигуры
+    std::vector<CellEntry> large_entries;
+};
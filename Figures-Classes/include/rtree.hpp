@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "figure_array.hpp"
+
+// R-дерево по ограничивающим прямоугольникам фигур.
+// Строится упаковкой STR (Sort-Tile-Recursive): прямоугольники сортируются по x, режутся на
+// вертикальные полосы, внутри полос сортируются по y и группируются по NODE_CAPACITY.
+// insert и remove повторяют FigureArray::add и FigureArray::pop; после многих удалений узлы
+// могут быть заполнены не полностью, build восстанавливает плотную упаковку.
+// Дерево хранит указатели на фигуры: фигуры не должны удаляться или изменяться, пока они в дереве.
+class RTree {
+public:
+    // Максимальное число элементов в узле
+    static constexpr size_t NODE_CAPACITY = 16;
+
+    // Конструкторы
+    RTree();
+
+    // Дерево по всем фигурам массива
+    explicit RTree(const FigureArray& arr);
+
+    // Перестроение по всем фигурам массива
+    void build(const FigureArray& arr);
+
+    // Добавление фигуры
+    void insert(const Figure& f);
+
+    // Удаление фигуры (false, если ее нет в дереве)
+    bool remove(const Figure& f);
+
+    // Количество фигур
+    size_t get_size() const { return size; }
+
+    // Высота дерева (0 - пустое дерево)
+    size_t get_height() const;
+
+    // Фигуры, содержащие точку
+    std::vector<const Figure*> query_point(const Point& p) const;
+
+    // Фигуры, пересекающие прямоугольник
+    std::vector<const Figure*> query_rect(const BoundingBox& rect) const;
+
+private:
+    struct Node;
+
+    // Элемент узла: фигура в листе или дочерний узел во внутреннем узле
+    struct Entry {
+        BoundingBox box;
+        const Figure* figure = nullptr;
+        std::unique_ptr<Node> child;
+    };
+
+    struct Node {
+        bool leaf = true;
+        std::vector<Entry> entries;
+
+        BoundingBox box() const;
+    };
+
+    // Упаковка элементов одного уровня в узлы
+    static std::vector<Entry> pack(std::vector<Entry> entries, bool leaf);
+
+    // Вставка в поддерево, при переполнении узел делится и возвращается новый сосед
+    static std::unique_ptr<Node> insert(Node& node, Entry entry);
+
+    // Удаление из поддерева
+    static bool remove(Node& node, const Figure* f, const BoundingBox& box);
+
+    // Деление переполненного узла пополам вдоль оси наибольшего разброса
+    static std::unique_ptr<Node> split(Node& node);
+
+    std::unique_ptr<Node> root;
+    size_t size;
+};
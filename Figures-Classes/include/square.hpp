@@ -12,6 +12,11 @@ public:
 
     Square(Point* verts);
 
+    // Конструкторы с массивом вершин из пула
+    explicit Square(FigurePool& pool);
+
+    Square(Point* verts, FigurePool& pool);
+
     // Конструктор копирования
     Square(const Square& other);
 
@@ -40,6 +45,9 @@ public:
     // Проверка на то, что точки образуют квадрат
     virtual bool isSquare() const;
 
+    // Квадрат остается квадратом только при подобии
+    virtual bool can_transform(const AffineTransform& m) const override;
+
     // Клонирование
     virtual Figure* clone() const override;
 
@@ -50,5 +58,8 @@ public:
     virtual bool equals(const Figure& other) const override;
 
 protected:
+    // Общий конструктор по вершинам (pool == nullptr - вершины в куче)
+    Square(Point* verts, FigurePool* pool);
+
     static constexpr size_t SQUARE_VERTICES = 4;
 };
\ No newline at end of file
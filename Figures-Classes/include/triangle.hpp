@@ -12,6 +12,11 @@ public:
 
     Triangle(Point* verts);
 
+    // Конструкторы с массивом вершин из пула
+    explicit Triangle(FigurePool& pool);
+
+    Triangle(Point* verts, FigurePool& pool);
+
     // Конструктор копирования
     Triangle(const Triangle& other);
 
@@ -47,5 +52,8 @@ public:
     virtual bool equals(const Figure& other) const override;
 
 protected:
+    // Общий конструктор по вершинам (pool == nullptr - вершины в куче)
+    Triangle(Point* verts, FigurePool* pool);
+
     static constexpr size_t TRIANGLE_VERTICES = 3;
 };
\ No newline at end of file
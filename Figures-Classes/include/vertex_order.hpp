@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include "point.hpp"
+
+// Упорядочивание вершин по обходу вокруг центра без тригонометрии.
+// Для каждой вершины один раз вычисляется псевдоугол - монотонная функция atan2(dy, dx),
+// после чего вершины сортируются по нему: сетями сортировки для 3, 4, 5 и 8 вершин,
+// вставками или std::sort для остальных. Порядок тот же, что при сравнении atan2.
+
+// Псевдоугол направления (dx, dy): растет вместе с atan2(dy, dx) и лежит в [-2, 2]
+inline double pseudo_angle(double dx, double dy) {
+    double sum = fabs(dx) + fabs(dy);
+    if (sum == 0) return 0.0;
+    double r = dx / sum;
+    // Нижняя полуплоскость (включая -0, как у atan2) - углы от -π до 0
+    return std::signbit(dy) ? r - 1.0 : 1.0 - r;
+}
+
+// Упорядочивание n вершин по возрастанию угла вокруг точки c
+void order_vertices(Point* verts, size_t n, const Point& c);
+
+// Пакетное упорядочивание count фигур по n вершин, лежащих подряд в verts.
+// Центр каждой фигуры - среднее ее вершин, как в Figure::center
+void order_vertices_batch(Point* verts, size_t n, size_t count, size_t threads = 1);
@@ -18,13 +18,17 @@ int main() {
     std::cout << "octagon\n";
     std::cout << "x1 y1 ... x8 y8\n";
     std::cout << std::endl;
-    std::cout << "4. Вывести центры, площади и общую площадь всех фигур\n";
+    std::cout << "4. Добавить выпуклый многоугольник (выпуклая оболочка n точек)\n";
+    std::cout << "polygon\n";
+    std::cout << "n x1 y1 ... xn yn\n";
+    std::cout << std::endl;
+    std::cout << "5. Вывести центры, площади и общую площадь всех фигур\n";
     std::cout << "print\n";
     std::cout << std::endl;
-    std::cout << "5. Удалить фигуру по индексу (начиная с 0)\n";
+    std::cout << "6. Удалить фигуру по индексу (начиная с 0)\n";
     std::cout << "remove index\n";
     std::cout << std::endl;
-    std::cout << "6. Выйти из программы\n";
+    std::cout << "7. Выйти из программы\n";
     std::cout << "exit\n";
     std::cout << std::endl;
     std::cout << "Введите команды:\n";
@@ -33,17 +37,21 @@ int main() {
     std::string command;
     while (std::cin >> command) {
         if (command == "triangle") {
-            Triangle* t = new Triangle();
+            Triangle* t = new (arr.get_pool()) Triangle(arr.get_pool());
             std::cin >> *t;
             arr.add(*t);
         } else if (command == "square") {
-            Square* s = new Square();
+            Square* s = new (arr.get_pool()) Square(arr.get_pool());
             std::cin >> *s;
             arr.add(*s);
         } else if (command == "octagon") {
-            Octagon* o = new Octagon();
+            Octagon* o = new (arr.get_pool()) Octagon(arr.get_pool());
             std::cin >> *o;
             arr.add(*o);
+        } else if (command == "polygon") {
+            ConvexPolygon* p = new (arr.get_pool()) ConvexPolygon(arr.get_pool());
+            std::cin >> *p;
+            arr.add(*p);
         } else if (command == "print") {
             std::cout << "Centers:" << std::endl;
             arr.array_center();
@@ -0,0 +1,91 @@
+#include "../include/affine.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AFFINE_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+void transform_points_scalar(Point* points, size_t n, const AffineTransform& m) {
+    for (size_t i = 0; i < n; ++i) {
+        points[i] = m.apply(points[i]);
+    }
+}
+
+void transform_columns_scalar(double* xs, double* ys, size_t n, const AffineTransform& m) {
+    for (size_t i = 0; i < n; ++i) {
+        double x = xs[i];
+        double y = ys[i];
+        xs[i] = m.a * x + m.b * y + m.tx;
+        ys[i] = m.c * x + m.d * y + m.ty;
+    }
+}
+
+#ifdef AFFINE_AVX2
+
+// Две точки в регистре: (x0, y0, x1, y1) * (a, d, a, d) + (y0, x0, y1, x1) * (b, c, b, c) + (tx, ty, tx, ty).
+// Умножения и сложения идут отдельно и в том же порядке, что в AffineTransform::apply (без FMA),
+// поэтому результат побитово совпадает со скалярным и не зависит от процессора
+__attribute__((target("avx2")))
+void transform_points_avx2(Point* points, size_t n, const AffineTransform& m) {
+    const __m256d diagonal = _mm256_setr_pd(m.a, m.d, m.a, m.d);
+    const __m256d cross = _mm256_setr_pd(m.b, m.c, m.b, m.c);
+    const __m256d shift = _mm256_setr_pd(m.tx, m.ty, m.tx, m.ty);
+    double* data = reinterpret_cast<double*>(points);
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m256d p = _mm256_loadu_pd(data + 2 * i);
+        __m256d swapped = _mm256_permute_pd(p, 0b0101);
+        __m256d r = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(p, diagonal), _mm256_mul_pd(swapped, cross)), shift);
+        _mm256_storeu_pd(data + 2 * i, r);
+    }
+    transform_points_scalar(points + i, n - i, m);
+}
+
+// Четыре точки за раз по столбцам, операции те же, что в скалярной версии
+__attribute__((target("avx2")))
+void transform_columns_avx2(double* xs, double* ys, size_t n, const AffineTransform& m) {
+    const __m256d a = _mm256_set1_pd(m.a), b = _mm256_set1_pd(m.b), tx = _mm256_set1_pd(m.tx);
+    const __m256d c = _mm256_set1_pd(m.c), d = _mm256_set1_pd(m.d), ty = _mm256_set1_pd(m.ty);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(xs + i);
+        __m256d y = _mm256_loadu_pd(ys + i);
+        _mm256_storeu_pd(xs + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a, x), _mm256_mul_pd(b, y)), tx));
+        _mm256_storeu_pd(ys + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(c, x), _mm256_mul_pd(d, y)), ty));
+    }
+    transform_columns_scalar(xs + i, ys + i, n - i, m);
+}
+
+#endif
+
+// Выбор реализации по возможностям процессора
+bool has_avx2() {
+#ifdef AFFINE_AVX2
+    static const bool result = __builtin_cpu_supports("avx2");
+    return result;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+// Преобразование точек, лежащих подряд
+void transform_points(Point* points, size_t n, const AffineTransform& m) {
+#ifdef AFFINE_AVX2
+    if (has_avx2()) return transform_points_avx2(points, n, m);
+#endif
+    transform_points_scalar(points, n, m);
+}
+
+// Преобразование точек по столбцам
+void transform_columns(double* xs, double* ys, size_t n, const AffineTransform& m) {
+#ifdef AFFINE_AVX2
+    if (has_avx2()) return transform_columns_avx2(xs, ys, n, m);
+#endif
+    transform_columns_scalar(xs, ys, n, m);
+}
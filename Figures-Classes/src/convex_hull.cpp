@@ -0,0 +1,127 @@
+#include "../include/convex_hull.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+// Ориентация тройки: > 0 - поворот против часовой стрелки
+inline double cross(const Point& o, const Point& a, const Point& b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+inline bool less_xy(const Point& a, const Point& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+// Монотонная цепочка по отсортированным различным точкам
+std::vector<Point> chain(const std::vector<Point>& sorted) {
+    size_t n = sorted.size();
+    if (n < 3) return sorted;
+
+    std::vector<Point> hull(2 * n);
+    size_t k = 0;
+    // Нижняя цепочка
+    for (size_t i = 0; i < n; ++i) {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], sorted[i]) <= 0) --k;
+        hull[k++] = sorted[i];
+    }
+    // Верхняя цепочка
+    for (size_t i = n - 1, lower = k + 1; i-- > 0;) {
+        while (k >= lower && cross(hull[k - 2], hull[k - 1], sorted[i]) <= 0) --k;
+        hull[k++] = sorted[i];
+    }
+    // Последняя точка совпадает с первой
+    hull.resize(k - 1);
+    return hull;
+}
+
+// Сортировка, удаление повторов и цепочка
+std::vector<Point> hull_of(std::vector<Point>& points) {
+    std::sort(points.begin(), points.end(), less_xy);
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    return chain(points);
+}
+
+// Точка p на отрезке [a, b]
+inline bool on_segment(const Point& a, const Point& b, const Point& p) {
+    return cross(a, b, p) == 0 && std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+           std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+}
+
+} // namespace
+
+// Выпуклая оболочка
+std::vector<Point> convex_hull(std::vector<Point> points) {
+    return hull_of(points);
+}
+
+// Параллельная выпуклая оболочка
+std::vector<Point> parallel_convex_hull(const std::vector<Point>& points, size_t threads) {
+    size_t n = points.size();
+    constexpr size_t MIN_CHUNK = 16384;
+    if (n < 8) return convex_hull(points);
+
+    // Крайние точки по восьми направлениям (x, y и диагонали) и их выпуклая оболочка
+    Point extreme[8];
+    std::fill(extreme, extreme + 8, points[0]);
+    for (const auto& p : points) {
+        if (p.x < extreme[0].x) extreme[0] = p;
+        if (p.x + p.y < extreme[1].x + extreme[1].y) extreme[1] = p;
+        if (p.y < extreme[2].y) extreme[2] = p;
+        if (p.x - p.y > extreme[3].x - extreme[3].y) extreme[3] = p;
+        if (p.x > extreme[4].x) extreme[4] = p;
+        if (p.x + p.y > extreme[5].x + extreme[5].y) extreme[5] = p;
+        if (p.y > extreme[6].y) extreme[6] = p;
+        if (p.x - p.y < extreme[7].x - extreme[7].y) extreme[7] = p;
+    }
+    std::vector<Point> filter = convex_hull(std::vector<Point>(extreme, extreme + 8));
+
+    // Точка строго внутри многоугольника крайних точек не может быть вершиной оболочки
+    auto inside = [&](const Point& p) {
+        if (filter.size() < 3) return false;
+        for (size_t e = 0; e < filter.size(); ++e) {
+            if (cross(filter[e], filter[(e + 1) % filter.size()], p) <= 0) return false;
+        }
+        return true;
+    };
+
+    threads = std::max<size_t>(1, std::min(threads, (n + MIN_CHUNK - 1) / MIN_CHUNK));
+    size_t part = (n + threads - 1) / threads;
+    std::vector<std::vector<Point>> hulls(threads);
+    auto run = [&](size_t t) {
+        size_t begin = std::min(n, t * part);
+        size_t end = std::min(n, begin + part);
+        std::vector<Point> candidates;
+        for (size_t i = begin; i < end; ++i) {
+            if (!inside(points[i])) candidates.push_back(points[i]);
+        }
+        hulls[t] = hull_of(candidates);
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) workers.emplace_back(run, t);
+    run(0);
+    for (auto& worker : workers) worker.join();
+
+    // Оболочка объединения оболочек кусков
+    std::vector<Point> merged;
+    for (auto& hull : hulls) merged.insert(merged.end(), hull.begin(), hull.end());
+    merged.insert(merged.end(), filter.begin(), filter.end());
+    return hull_of(merged);
+}
+
+// Проверка выпуклого положения
+bool in_convex_position(const Point* points, size_t n) {
+    std::vector<Point> hull = convex_hull(std::vector<Point>(points, points + n));
+    size_t h = hull.size();
+    if (h < 3) return true;  // все точки на одной прямой
+
+    for (size_t i = 0; i < n; ++i) {
+        bool on_boundary = false;
+        for (size_t e = 0; e < h && !on_boundary; ++e) {
+            on_boundary = on_segment(hull[e], hull[(e + 1) % h], points[i]);
+        }
+        if (!on_boundary) return false;
+    }
+    return true;
+}
@@ -0,0 +1,90 @@
+#include "../include/convex_polygon.hpp"
+#include "../include/convex_hull.hpp"
+
+// Конструкторы
+ConvexPolygon::ConvexPolygon() : Figure(MIN_VERTICES) {}
+
+ConvexPolygon::ConvexPolygon(const std::vector<Point>& points) : ConvexPolygon(points, nullptr) {}
+
+ConvexPolygon::ConvexPolygon(FigurePool& pool) : Figure(MIN_VERTICES, &pool) {}
+
+ConvexPolygon::ConvexPolygon(const std::vector<Point>& points, FigurePool& pool) : ConvexPolygon(points, &pool) {}
+
+ConvexPolygon::ConvexPolygon(const std::vector<Point>& points, FigurePool* pool) : Figure(MIN_VERTICES, pool) {
+    build(points);
+}
+
+// Конструктор копирования
+ConvexPolygon::ConvexPolygon(const ConvexPolygon& other) : Figure(other) {}
+
+// Оператор присваивания копированием
+ConvexPolygon& ConvexPolygon::operator=(const ConvexPolygon& other) {
+    Figure::operator=(other);
+    return *this;
+}
+
+// Конструктор перемещения
+ConvexPolygon::ConvexPolygon(ConvexPolygon&& other) noexcept : Figure(std::move(other)) {}
+
+// Конструктор присваивания перемещением
+ConvexPolygon& ConvexPolygon::operator=(ConvexPolygon&& other) noexcept {
+    Figure::operator=(std::move(other));
+    return *this;
+}
+
+// Геометрический центр (центроид)
+Point ConvexPolygon::center() const {
+    return Figure::center();
+}
+
+// Построение по выпуклой оболочке
+void ConvexPolygon::build(const std::vector<Point>& points) {
+    std::vector<Point> hull = convex_hull(points);
+    if (hull.size() < 3) {
+        throw std::invalid_argument("Degenerate polygon");
+    }
+    assign_vertices(hull.data(), hull.size());
+    this->sortVertices();
+}
+
+// Чтение/запись
+void ConvexPolygon::read(std::istream& in) {
+    size_t n;
+    if (!(in >> n)) {
+        throw std::invalid_argument("Polygon has no vertex count");
+    }
+    if (n < MIN_VERTICES || n > MAX_VERTICES) {
+        throw std::invalid_argument("Invalid vertex count in polygon");
+    }
+    // Память растет по мере чтения точек, а не по заявленному числу
+    std::vector<Point> points;
+    points.reserve(std::min<size_t>(n, 1024));
+    for (size_t i = 0; i < n; ++i) {
+        Point p;
+        if (!(in >> p)) {
+            throw std::invalid_argument("Polygon vertex is missing");
+        }
+        points.push_back(p);
+    }
+    build(points);
+}
+
+void ConvexPolygon::write(std::ostream& out) const {
+    out << this->vertices_num << " ";
+    Figure::write(out);
+}
+
+// Площадь через приведение к double
+ConvexPolygon::operator double() const {
+    return Figure::operator double();
+}
+
+// Клонирование
+Figure* ConvexPolygon::clone() const {
+    return new ConvexPolygon(*this);
+}
+
+// Проверка на равенство
+bool ConvexPolygon::equals(const Figure& other) const {
+    return Figure::equals(other);
+}
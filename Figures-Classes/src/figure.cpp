@@ -1,37 +1,46 @@
 #include "../include/figure.hpp"
+#include "../include/vertex_order.hpp"
 #include <algorithm>
 
+namespace {
+
+// Заголовок перед каждой фигурой, выделенной через new: откуда взята память и сколько
+struct AllocationHeader {
+    FigurePool* pool;
+    size_t size;
+};
+
+static_assert(sizeof(AllocationHeader) % alignof(std::max_align_t) == 0);
+
+} // namespace
+
 // Конструкторы
 Figure::Figure() : Figure(1) {}
 
-Figure::Figure(size_t n) : vertices_num(n) {
-    this->vertices = new Point[n];
+Figure::Figure(size_t n) : Figure(n, static_cast<FigurePool*>(nullptr)) {}
 
-    for (size_t i = 0; i < n; ++i) {
-        this->vertices[i] = Point();
-    }
-}
+Figure::Figure(size_t n, Point* verts) : Figure(n, verts, nullptr) {}
 
-Figure::Figure(size_t n, Point* verts) : vertices_num(n) {
-    this->vertices = new Point[n];
+Figure::Figure(size_t n, FigurePool* pool) : vertices_num(n), pool(pool) {
+    this->vertices = allocate_vertices(n);
+}
 
+Figure::Figure(size_t n, Point* verts, FigurePool* pool) : Figure(n, pool) {
     if (verts != nullptr) {
         for (size_t i = 0; i < n; ++i) {
             this->vertices[i] = verts[i];
-        }        
-    } else {
-        for (size_t i = 0; i < n; ++i) {
-            this->vertices[i] = Point();
         }
     }
 
+    // Вершины приходят в любом порядке: сначала они упорядочиваются по обходу
+    Figure::sortVertices();
     if (!isConvex()) {
         throw std::invalid_argument("Figure is not convex");
     }
 }
 
 // Конструктор копирования
-Figure::Figure(const Figure& other) : vertices_num(other.vertices_num) {
+Figure::Figure(const Figure& other) : vertices_num(other.vertices_num), cache(other.cache) {
     size_t n = other.vertices_num;
     this->vertices = new Point[n];
 
@@ -43,31 +52,39 @@ Figure::Figure(const Figure& other) : vertices_num(other.vertices_num) {
 // Оператор присваивания копированием
 Figure& Figure::operator=(const Figure& other) {
     if (this != &other) {
-        delete[] this->vertices;
+        free_vertices();
         this->vertices_num = other.vertices_num;
-        this->vertices = new Point[other.vertices_num];
+        this->vertices = allocate_vertices(other.vertices_num);
 
         for (size_t i = 0; i < this->vertices_num; ++i) {
             this->vertices[i] = other.vertices[i];
         }
+        this->cache = other.cache;
     }
     return *this;
 }
 
 // Конструктор перемещения
-Figure::Figure(Figure&& other) noexcept : vertices_num(other.vertices_num), vertices(other.vertices) {
+Figure::Figure(Figure&& other) noexcept
+    : vertices_num(other.vertices_num), vertices(other.vertices), pool(other.pool), cache(other.cache) {
     other.vertices_num = 0;
     other.vertices = nullptr;
+    other.pool = nullptr;
+    other.update_cache();
 }
 
 // Оператор присваивания перемещением
 Figure& Figure::operator=(Figure&& other) noexcept {
     if (this != &other) {
-        delete[] this->vertices;
+        free_vertices();
         this->vertices = other.vertices;
         this->vertices_num = other.vertices_num;
+        this->pool = other.pool;
+        this->cache = other.cache;
         other.vertices = nullptr;
         other.vertices_num = 0;
+        other.pool = nullptr;
+        other.update_cache();
     }
 
     return *this;
@@ -75,18 +92,82 @@ Figure& Figure::operator=(Figure&& other) noexcept {
 
 // Деструктор
 Figure::~Figure() {
-    delete[] this->vertices;
+    free_vertices();
+}
+
+// Выделение памяти под фигуру
+void* Figure::operator new(size_t size) {
+    auto* header = static_cast<AllocationHeader*>(::operator new(sizeof(AllocationHeader) + size));
+    *header = {nullptr, size};
+    return header + 1;
+}
+
+void* Figure::operator new(size_t size, FigurePool& pool) {
+    auto* header = static_cast<AllocationHeader*>(pool.allocate(sizeof(AllocationHeader) + size));
+    *header = {&pool, size};
+    return header + 1;
+}
+
+void Figure::operator delete(void* p) {
+    if (p == nullptr) return;
+    auto* header = static_cast<AllocationHeader*>(p) - 1;
+    if (header->pool != nullptr) {
+        header->pool->deallocate(header, sizeof(AllocationHeader) + header->size);
+    } else {
+        ::operator delete(header);
+    }
+}
+
+// Вызывается, если конструктор фигуры из пула бросил исключение
+void Figure::operator delete(void* p, FigurePool&) {
+    Figure::operator delete(p);
+}
+
+// Замена вершин (массив другого размера перевыделяется из того же пула)
+void Figure::assign_vertices(const Point* verts, size_t n) {
+    if (n != this->vertices_num || this->vertices == nullptr) {
+        free_vertices();
+        this->vertices_num = n;
+        this->vertices = allocate_vertices(n);
+    }
+    std::copy(verts, verts + n, this->vertices);
+    update_cache();
+}
+
+// Массив из n вершин (0, 0)
+Point* Figure::allocate_vertices(size_t n) const {
+    if (this->pool == nullptr) {
+        return new Point[n];
+    }
+    Point* verts = static_cast<Point*>(this->pool->allocate(n * sizeof(Point)));
+    std::uninitialized_default_construct_n(verts, n);
+    return verts;
+}
+
+void Figure::free_vertices() {
+    if (this->pool == nullptr) {
+        delete[] this->vertices;
+    } else if (this->vertices != nullptr) {
+        this->pool->deallocate(this->vertices, this->vertices_num * sizeof(Point));
+    }
+    this->vertices = nullptr;
 }
 
 // Чтение и запись
 void Figure::read(std::istream& in) {
     size_t n;
     in >> n;
-    this->vertices_num = n;
+    if (n != this->vertices_num) {
+        // Массив вершин другого размера
+        free_vertices();
+        this->vertices_num = n;
+        this->vertices = allocate_vertices(n);
+    }
 
     for (size_t i = 0; i < n; ++i) {
         in >> this->vertices[i];
     }
+    Figure::sortVertices();
 
     if (!isConvex()) {
         throw std::invalid_argument("Figure is not convex");
@@ -111,8 +192,13 @@ bool Figure::equals(const Figure& other) const {
     return true;
 }
 
-// Нахождение центроида
+// Геометрический центр (центроид)
 Point Figure::center() const {
+    return cache.center;
+}
+
+Point Figure::compute_center() const {
+    if (this->vertices_num == 0) return Point();
     Point center;
     for (size_t i = 0; i < this->vertices_num; ++i) {
         center = center + this->vertices[i];
@@ -120,18 +206,115 @@ Point Figure::center() const {
     return center / this->vertices_num;
 }
 
-// Сортировка вершин по порядку обхода
+// Ограничивающий прямоугольник
+BoundingBox Figure::bounding_box() const {
+    return cache.bbox;
+}
+
+BoundingBox Figure::compute_bounding_box() const {
+    if (this->vertices_num == 0) return BoundingBox();
+    BoundingBox box{this->vertices[0], this->vertices[0]};
+    for (size_t i = 1; i < this->vertices_num; ++i) {
+        box.min.x = std::min(box.min.x, this->vertices[i].x);
+        box.min.y = std::min(box.min.y, this->vertices[i].y);
+        box.max.x = std::max(box.max.x, this->vertices[i].x);
+        box.max.y = std::max(box.max.y, this->vertices[i].y);
+    }
+    return box;
+}
+
+// Принадлежность точки выпуклой фигуре: точка не должна лежать по разные стороны от ребер
+bool Figure::contains(const Point& p) const {
+    if (vertices_num < 3 || !bounding_box().contains(p)) return false;
+
+    bool has_positive = false;
+    bool has_negative = false;
+    for (size_t i = 0; i < vertices_num; ++i) {
+        const Point& a = vertices[i];
+        const Point& b = vertices[(i + 1) % vertices_num];
+        double cross = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+        has_positive |= cross > 0;
+        has_negative |= cross < 0;
+    }
+    return !(has_positive && has_negative);
+}
+
+// Пересечение с прямоугольником: проверяются оси прямоугольника и нормали ребер фигуры
+bool Figure::intersects(const BoundingBox& rect) const {
+    if (vertices_num == 0 || !bounding_box().overlaps(rect)) return false;
+
+    Point corners[4] = {rect.min, {rect.max.x, rect.min.y}, rect.max, {rect.min.x, rect.max.y}};
+    for (size_t i = 0; i < vertices_num; ++i) {
+        const Point& a = vertices[i];
+        const Point& b = vertices[(i + 1) % vertices_num];
+        Point normal{a.y - b.y, b.x - a.x};
+
+        // Проекции фигуры и прямоугольника на нормаль ребра
+        double figure_min = 0.0, figure_max = 0.0;
+        for (size_t j = 0; j < vertices_num; ++j) {
+            double d = normal.x * vertices[j].x + normal.y * vertices[j].y;
+            if (j == 0 || d < figure_min) figure_min = d;
+            if (j == 0 || d > figure_max) figure_max = d;
+        }
+        double rect_min = 0.0, rect_max = 0.0;
+        for (size_t j = 0; j < 4; ++j) {
+            double d = normal.x * corners[j].x + normal.y * corners[j].y;
+            if (j == 0 || d < rect_min) rect_min = d;
+            if (j == 0 || d > rect_max) rect_max = d;
+        }
+        if (figure_max < rect_min || rect_max < figure_min) return false;
+    }
+    return true;
+}
+
+// Любое невырожденное преобразование переводит выпуклую фигуру в выпуклую
+bool Figure::can_transform(const AffineTransform& m) const {
+    double det = m.determinant();
+    return det != 0.0 && std::isfinite(det);
+}
+
+// Аффинное преобразование
+void Figure::transform(const AffineTransform& m) {
+    if (!can_transform(m)) {
+        throw std::invalid_argument("Transform is not allowed for " + type());
+    }
+    transform_points(vertices, vertices_num, m);
+
+    cache.area *= fabs(m.determinant());
+    cache.center = m.apply(cache.center);
+    cache.bbox = compute_bounding_box();
+
+    // Поворот и отражение меняют начало и направление обхода - вершины упорядочиваются заново
+    // (площадь по модулю от порядка обхода не зависит)
+    if (!m.preserves_order()) {
+        order_vertices(vertices, vertices_num, cache.center);
+    }
+}
+
+// Пересчет запомненных значений
+void Figure::update_cache() {
+    cache.area = compute_area();
+    cache.center = compute_center();
+    cache.bbox = compute_bounding_box();
+}
+
+// Сортировка вершин по порядку обхода (центр и прямоугольник от порядка не зависят)
 void Figure::sortVertices() {
-    Point c = center();
-    std::sort(vertices, vertices + vertices_num, [&](const Point& a, const Point& b) {
-        double angleA = atan2(a.y - c.y, a.x - c.x);
-        double angleB = atan2(b.y - c.y, b.x - c.x);
-        return angleA < angleB;
-    });
+    cache.center = compute_center();
+    order_vertices(vertices, vertices_num, cache.center);
+    cache.area = compute_area();
+    cache.bbox = compute_bounding_box();
 }
 
-// Нахождение площади с помощью метода шнурков
+// Площадь через приведение к double
 Figure::operator double() const {
+    return cache.area;
+}
+
+// Нахождение площади с помощью метода шнурков
+double Figure::compute_area() const {
+    if (this->vertices_num == 0) return 0.0;
+
     double S = 0;
     double sum1 = 0;
     double sum2 = 0;
@@ -145,7 +328,6 @@ Figure::operator double() const {
     sum2 += this->vertices[vertices_num - 1].y * this->vertices[0].x;
 
     S = 0.5 * fabs(sum1 - sum2);
-
     return S;
 }
 
@@ -1,9 +1,48 @@
 #include "../include/figure_array.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Деление блоков [0, blocks) на threads непрерывных кусков и запуск func(begin, end) на каждом
+template <typename Func>
+void parallel_blocks(size_t blocks, size_t threads, Func func) {
+    threads = std::max<size_t>(1, std::min(threads, blocks));
+    if (threads == 1) {
+        func(size_t(0), blocks);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    size_t chunk = (blocks + threads - 1) / threads;
+    for (size_t t = 1; t < threads; ++t) {
+        size_t begin = std::min(blocks, t * chunk);
+        size_t end = std::min(blocks, begin + chunk);
+        workers.emplace_back(func, begin, end);
+    }
+    func(size_t(0), std::min(blocks, chunk));
+    for (auto& worker : workers) worker.join();
+}
+
+// Попарное суммирование: погрешность растет как log(n), порядок сложений зависит только от n
+double pairwise_sum(const double* values, size_t n) {
+    if (n <= 8) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) sum += values[i];
+        return sum;
+    }
+    size_t half = n / 2;
+    return pairwise_sum(values, half) + pairwise_sum(values + half, n - half);
+}
+
+} // namespace
 
 // Конструкторы
 FigureArray::FigureArray() : FigureArray(0) {}
 
-FigureArray::FigureArray(size_t n) {
+FigureArray::FigureArray(size_t n, Storage storage) : storage(storage) {
     this->capacity = 10;
     if (n < 1) {
         // error 
@@ -14,7 +53,9 @@ FigureArray::FigureArray(size_t n) {
 }
 
 // Конструктор копирования
-FigureArray::FigureArray(const FigureArray& other) : size(other.size), capacity(other.capacity) {
+FigureArray::FigureArray(const FigureArray& other)
+    : size(other.size), capacity(other.capacity), storage(other.storage), columns(other.columns),
+      area_sum(other.area_sum), area_compensation(other.area_compensation) {
     if (this->size > 0) {
         this->array = new Figure*[capacity];
         for (size_t i = 0; i < this->size; ++i) {
@@ -35,6 +76,10 @@ FigureArray& FigureArray::operator=(const FigureArray& other) {
     }
     this->size = other.size;
     this->capacity = other.capacity;
+    this->storage = other.storage;
+    this->columns = other.columns;
+    this->area_sum = other.area_sum;
+    this->area_compensation = other.area_compensation;
     this->array = new Figure*[this->capacity];
     for (size_t i = 0; i < other.size; ++i) {
         this->array[i] = other.array[i]->clone();
@@ -43,7 +88,12 @@ FigureArray& FigureArray::operator=(const FigureArray& other) {
 }
 
 // Конструктор перемещения
-FigureArray::FigureArray(FigureArray&& other) noexcept : size(other.size), capacity(other.capacity), array(other.array) {
+FigureArray::FigureArray(FigureArray&& other) noexcept
+    : size(other.size), capacity(other.capacity), array(other.array), storage(other.storage), columns(std::move(other.columns)),
+      pool(std::move(other.pool)), area_sum(other.area_sum), area_compensation(other.area_compensation) {
+    other.columns.clear();
+    other.area_sum = 0.0;
+    other.area_compensation = 0.0;
     other.size = 0;
     other.capacity = 0;
     other.array = nullptr;    
@@ -60,6 +110,14 @@ FigureArray& FigureArray::operator=(FigureArray&& other) noexcept {
     this->size = other.size;
     this->capacity = other.capacity;
     this->array = other.array;
+    this->storage = other.storage;
+    this->columns = std::move(other.columns);
+    this->pool = std::move(other.pool);
+    this->area_sum = other.area_sum;
+    this->area_compensation = other.area_compensation;
+    other.columns.clear();
+    other.area_sum = 0.0;
+    other.area_compensation = 0.0;
     other.size = 0;
     other.capacity = 0;
     other.array = nullptr;
@@ -100,22 +158,120 @@ void FigureArray::add(Figure& f) {
         this->resize(this->size + 1);
     }
 
+    // Столбцы пополняются первыми: если они бросят исключение, массив не меняется
+    // и фигура остается у вызывающего
+    if (this->storage == Storage::Columns) {
+        this->columns.add(f);
+    }
+
     this->array[this->size] = &f;
     ++this->size;
+    update_area(static_cast<double>(f));
 }
 
 // Удаление по индексу
 void FigureArray::pop(size_t index) {
+    double area = static_cast<double>(*(this->array[index]));
     delete this->array[index];
     for (size_t i = index + 1; i < this->size; ++i) {
         this->array[i - 1] = this->array[i];
     }
     --this->size;
     this->array[this->size] = nullptr;
+    update_area(-area);
+
+    if (this->storage == Storage::Columns) {
+        this->columns.pop(index);
+    }
+}
+
+// Пул фигур массива
+FigurePool& FigureArray::get_pool() {
+    if (!this->pool) {
+        this->pool = std::make_unique<FigurePool>();
+    }
+    return *this->pool;
+}
+
+// Смена способа хранения
+void FigureArray::set_storage(Storage new_storage) {
+    if (new_storage == this->storage) return;
+
+    this->columns.clear();
+    if (new_storage == Storage::Columns) {
+        try {
+            for (size_t i = 0; i < this->size; ++i) {
+                this->columns.add(*(this->array[i]));
+            }
+        } catch (...) {
+            this->columns.clear();
+            throw;
+        }
+    }
+    this->storage = new_storage;
+}
+
+// Аффинное преобразование всех фигур
+void FigureArray::transform(const AffineTransform& m, size_t threads) {
+    transform_figures(m, nullptr, threads);
+}
+
+// Аффинное преобразование фигур одного типа
+void FigureArray::transform(const AffineTransform& m, const std::string& type, size_t threads) {
+    transform_figures(m, &type, threads);
+}
+
+void FigureArray::transform_figures(const AffineTransform& m, const std::string* type, size_t threads) {
+    // Отбор фигур и проверка до первого изменения
+    std::vector<size_t> selected;
+    double selected_area = 0.0;
+    for (size_t i = 0; i < this->size; ++i) {
+        const Figure& f = *this->array[i];
+        if (type != nullptr && f.type() != *type) continue;
+        if (!f.can_transform(m)) {
+            throw std::invalid_argument("Transform is not allowed for " + f.type() + " " + std::to_string(i));
+        }
+        if (type != nullptr) {
+            selected.push_back(i);
+            selected_area += static_cast<double>(f);
+        }
+    }
+    size_t count = type != nullptr ? selected.size() : this->size;
+
+    size_t blocks = (count + PARALLEL_BLOCK - 1) / PARALLEL_BLOCK;
+    parallel_blocks(blocks, threads, [&](size_t begin, size_t end) {
+        size_t last = std::min(count, end * PARALLEL_BLOCK);
+        for (size_t k = begin * PARALLEL_BLOCK; k < last; ++k) {
+            this->array[type != nullptr ? selected[k] : k]->transform(m);
+        }
+    });
+
+    // Площадь каждой фигуры умножилась на |det|
+    double scale = fabs(m.determinant());
+    if (type == nullptr) {
+        this->area_sum *= scale;
+        this->area_compensation *= scale;
+    } else {
+        update_area(selected_area * (scale - 1.0));
+    }
+
+    if (this->storage == Storage::Columns) {
+        if (type == nullptr) {
+            this->columns.transform(m);
+        } else {
+            for (size_t i : selected) this->columns.transform(i, m);
+        }
+    }
 }
 
 // Печатаем геометрический центр (центроид) всех фигур
 void FigureArray::array_center() const {
+    if (this->storage == Storage::Columns) {
+        for (const auto& c : this->columns.centers()) {
+            std::cout << c << std::endl;
+        }
+        return;
+    }
     for (size_t i = 0; i < this->size; ++i) {
         std::cout << this->array[i]->center() <<std::endl;
     }
@@ -123,6 +279,12 @@ void FigureArray::array_center() const {
 
 // Печатаем площадь всех фигур
 void FigureArray::array_square() const {
+    if (this->storage == Storage::Columns) {
+        for (double area : this->columns.areas()) {
+            std::cout << area << std::endl;
+        }
+        return;
+    }
     for (size_t i = 0; i < this->size; ++i) {
         std::cout << static_cast<double>(*(this->array[i])) <<std::endl;
     }
@@ -130,6 +292,14 @@ void FigureArray::array_square() const {
 
 // Общая площадь всех фигур
 double FigureArray::total_area() const {
+    return this->area_sum + this->area_compensation;
+}
+
+// Общая площадь, заново посчитанная по всем фигурам
+double FigureArray::compute_total_area() const {
+    if (this->storage == Storage::Columns) {
+        return this->columns.total_area();
+    }
     double sum = 0.0;
     for (size_t i = 0; i < this->size; ++i) {
         sum += static_cast<double>(*(this->array[i]));
@@ -137,6 +307,72 @@ double FigureArray::total_area() const {
     return sum;
 }
 
+// Общая площадь, посчитанная по всем фигурам параллельно
+double FigureArray::parallel_total_area(size_t threads) const {
+    size_t blocks = (this->size + PARALLEL_BLOCK - 1) / PARALLEL_BLOCK;
+    std::vector<double> sums(blocks);
+
+    parallel_blocks(blocks, threads, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b) {
+            size_t first = b * PARALLEL_BLOCK;
+            size_t n = std::min(this->size, first + PARALLEL_BLOCK) - first;
+            double areas[PARALLEL_BLOCK];
+            for (size_t i = 0; i < n; ++i) {
+                areas[i] = static_cast<double>(*(this->array[first + i]));
+            }
+            sums[b] = pairwise_sum(areas, n);
+        }
+    });
+    return pairwise_sum(sums.data(), sums.size());
+}
+
+// Печатаем центры всех фигур
+void FigureArray::parallel_array_center(size_t threads) const {
+    std::vector<Point> centers(this->size);
+    size_t blocks = (this->size + PARALLEL_BLOCK - 1) / PARALLEL_BLOCK;
+    parallel_blocks(blocks, threads, [&](size_t begin, size_t end) {
+        size_t last = std::min(this->size, end * PARALLEL_BLOCK);
+        for (size_t i = begin * PARALLEL_BLOCK; i < last; ++i) {
+            centers[i] = this->array[i]->center();
+        }
+    });
+    for (const auto& c : centers) {
+        std::cout << c << std::endl;
+    }
+}
+
+// Печатаем площади всех фигур
+void FigureArray::parallel_array_square(size_t threads) const {
+    std::vector<double> areas(this->size);
+    size_t blocks = (this->size + PARALLEL_BLOCK - 1) / PARALLEL_BLOCK;
+    parallel_blocks(blocks, threads, [&](size_t begin, size_t end) {
+        size_t last = std::min(this->size, end * PARALLEL_BLOCK);
+        for (size_t i = begin * PARALLEL_BLOCK; i < last; ++i) {
+            areas[i] = static_cast<double>(*(this->array[i]));
+        }
+    });
+    for (double area : areas) {
+        std::cout << area << std::endl;
+    }
+}
+
+// Изменение суммы площадей (суммирование Ноймайера: потерянные младшие разряды копятся отдельно)
+void FigureArray::update_area(double delta) {
+    double sum = this->area_sum + delta;
+    if (fabs(this->area_sum) >= fabs(delta)) {
+        this->area_compensation += (this->area_sum - sum) + delta;
+    } else {
+        this->area_compensation += (delta - sum) + this->area_sum;
+    }
+    this->area_sum = sum;
+
+    // Пустой массив имеет ровно нулевую площадь, накопленная погрешность отбрасывается
+    if (this->size == 0) {
+        this->area_sum = 0.0;
+        this->area_compensation = 0.0;
+    }
+}
+
 // Чтение/запись
 void FigureArray::read(std::istream& in) {
     std::string type;
@@ -144,11 +380,13 @@ void FigureArray::read(std::istream& in) {
         Figure* f = nullptr;
         try {
             if (type == "triangle") {
-                f = new Triangle();
+                f = new (get_pool()) Triangle(get_pool());
             } else if (type == "square") {
-                f = new Square();
+                f = new (get_pool()) Square(get_pool());
             } else if (type == "octagon") {
-                f = new Octagon();
+                f = new (get_pool()) Octagon(get_pool());
+            } else if (type == "polygon") {
+                f = new (get_pool()) ConvexPolygon(get_pool());
             } else {
                 // unknown type, skip
                 continue;
@@ -0,0 +1,311 @@
+#include "../include/figure_columns.hpp"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FIGURE_COLUMNS_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Столбцы одной группы: xs[v] и ys[v] - координаты вершины v всех count фигур
+struct Columns {
+    std::vector<const double*> xs;
+    std::vector<const double*> ys;
+    size_t n;
+    size_t count;
+};
+
+Columns columns_of(const std::vector<std::vector<double>>& xs, const std::vector<std::vector<double>>& ys) {
+    Columns c;
+    c.n = xs.size();
+    c.count = xs[0].size();
+    for (size_t v = 0; v < c.n; ++v) {
+        c.xs.push_back(xs[v].data());
+        c.ys.push_back(ys[v].data());
+    }
+    return c;
+}
+
+// Метод шнурков для фигур [begin, count), порядок операций тот же, что в Figure::operator double.
+// Площади пишутся в out (если он задан), возвращается их сумма
+double shoelace_scalar(const Columns& c, size_t begin, double* out) {
+    double total = 0.0;
+    for (size_t i = begin; i < c.count; ++i) {
+        double sum1 = 0;
+        double sum2 = 0;
+        for (size_t v = 0; v + 1 < c.n; ++v) {
+            sum1 += c.xs[v][i] * c.ys[v + 1][i];
+            sum2 += c.ys[v][i] * c.xs[v + 1][i];
+        }
+        sum1 += c.xs[c.n - 1][i] * c.ys[0][i];
+        sum2 += c.ys[c.n - 1][i] * c.xs[0][i];
+
+        double S = 0.5 * fabs(sum1 - sum2);
+        if (out != nullptr) out[i] = S;
+        total += S;
+    }
+    return total;
+}
+
+// Центры фигур [begin, count) как среднее вершин, как в Figure::center
+void centers_scalar(const Columns& c, size_t begin, double* cx, double* cy) {
+    for (size_t i = begin; i < c.count; ++i) {
+        cx[i] = c.xs[0][i];
+        cy[i] = c.ys[0][i];
+    }
+    for (size_t v = 1; v < c.n; ++v) {
+        for (size_t i = begin; i < c.count; ++i) {
+            cx[i] += c.xs[v][i];
+            cy[i] += c.ys[v][i];
+        }
+    }
+    double n = static_cast<double>(c.n);
+    for (size_t i = begin; i < c.count; ++i) {
+        cx[i] /= n;
+        cy[i] /= n;
+    }
+}
+
+#ifdef FIGURE_COLUMNS_AVX2
+
+// Те же вычисления по 4 фигуры за раз
+__attribute__((target("avx2")))
+double shoelace_avx2(const Columns& c, double* out) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    __m256d total = _mm256_setzero_pd();
+
+    size_t i = 0;
+    for (; i + 4 <= c.count; i += 4) {
+        __m256d sum1 = _mm256_setzero_pd();
+        __m256d sum2 = _mm256_setzero_pd();
+        const __m256d x0 = _mm256_loadu_pd(c.xs[0] + i);
+        const __m256d y0 = _mm256_loadu_pd(c.ys[0] + i);
+        __m256d x = x0;
+        __m256d y = y0;
+        for (size_t v = 1; v < c.n; ++v) {
+            __m256d nx = _mm256_loadu_pd(c.xs[v] + i);
+            __m256d ny = _mm256_loadu_pd(c.ys[v] + i);
+            sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(x, ny));
+            sum2 = _mm256_add_pd(sum2, _mm256_mul_pd(y, nx));
+            x = nx;
+            y = ny;
+        }
+        sum1 = _mm256_add_pd(sum1, _mm256_mul_pd(x, y0));
+        sum2 = _mm256_add_pd(sum2, _mm256_mul_pd(y, x0));
+
+        __m256d S = _mm256_mul_pd(half, _mm256_andnot_pd(sign, _mm256_sub_pd(sum1, sum2)));
+        if (out != nullptr) _mm256_storeu_pd(out + i, S);
+        total = _mm256_add_pd(total, S);
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, total);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + shoelace_scalar(c, i, out);
+}
+
+__attribute__((target("avx2")))
+void centers_avx2(const Columns& c, double* cx, double* cy) {
+    const __m256d n = _mm256_set1_pd(static_cast<double>(c.n));
+
+    size_t i = 0;
+    for (; i + 4 <= c.count; i += 4) {
+        __m256d x = _mm256_loadu_pd(c.xs[0] + i);
+        __m256d y = _mm256_loadu_pd(c.ys[0] + i);
+        for (size_t v = 1; v < c.n; ++v) {
+            x = _mm256_add_pd(x, _mm256_loadu_pd(c.xs[v] + i));
+            y = _mm256_add_pd(y, _mm256_loadu_pd(c.ys[v] + i));
+        }
+        _mm256_storeu_pd(cx + i, _mm256_div_pd(x, n));
+        _mm256_storeu_pd(cy + i, _mm256_div_pd(y, n));
+    }
+    centers_scalar(c, i, cx, cy);
+}
+
+#endif
+
+// Выбор реализации по возможностям процессора
+bool has_avx2() {
+#ifdef FIGURE_COLUMNS_AVX2
+    static const bool result = __builtin_cpu_supports("avx2");
+    return result;
+#else
+    return false;
+#endif
+}
+
+double shoelace(const Columns& c, double* out) {
+#ifdef FIGURE_COLUMNS_AVX2
+    if (has_avx2()) return shoelace_avx2(c, out);
+#endif
+    return shoelace_scalar(c, 0, out);
+}
+
+void vertex_means(const Columns& c, double* cx, double* cy) {
+#ifdef FIGURE_COLUMNS_AVX2
+    if (has_avx2()) return centers_avx2(c, cx, cy);
+#endif
+    centers_scalar(c, 0, cx, cy);
+}
+
+} // namespace
+
+// Добавление вершин фигуры в конец
+void FigureColumns::add(const Figure& f) {
+    size_t n = f.get_vertices_num();
+    if (n == 0) {
+        throw std::invalid_argument("Figure has no vertices");
+    }
+
+    size_t g = 0;
+    while (g < groups.size() && groups[g].vertices_num != n) ++g;
+    bool new_group = g == groups.size();
+    if (new_group) {
+        groups.push_back({n, std::vector<std::vector<double>>(n), std::vector<std::vector<double>>(n)});
+    }
+
+    // Память резервируется до записи: при нехватке памяти столбцы остаются прежними
+    Group& group = groups[g];
+    try {
+        size_t count = group.get_size() + 1;
+        if (slots.size() == slots.capacity()) slots.reserve(2 * slots.size() + 1);
+        for (size_t v = 0; v < n; ++v) {
+            if (group.xs[v].size() == group.xs[v].capacity()) group.xs[v].reserve(2 * count);
+            if (group.ys[v].size() == group.ys[v].capacity()) group.ys[v].reserve(2 * count);
+        }
+    } catch (...) {
+        if (new_group) groups.pop_back();
+        throw;
+    }
+
+    const Point* verts = f.get_vertices();
+    for (size_t v = 0; v < n; ++v) {
+        group.xs[v].push_back(verts[v].x);
+        group.ys[v].push_back(verts[v].y);
+    }
+    slots.push_back({g, group.get_size() - 1});
+}
+
+// Удаление по индексу
+void FigureColumns::pop(size_t index) {
+    if (index >= slots.size()) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    Slot slot = slots[index];
+    Group& group = groups[slot.group];
+    for (size_t v = 0; v < group.vertices_num; ++v) {
+        group.xs[v].erase(group.xs[v].begin() + slot.position);
+        group.ys[v].erase(group.ys[v].begin() + slot.position);
+    }
+    slots.erase(slots.begin() + index);
+
+    // Фигуры группы, стоявшие после удаленной, сдвинулись на одну позицию
+    for (auto& other : slots) {
+        if (other.group == slot.group && other.position > slot.position) --other.position;
+    }
+}
+
+// Удаление всех фигур
+void FigureColumns::clear() {
+    groups.clear();
+    slots.clear();
+}
+
+// Площадь фигуры по индексу
+double FigureColumns::area(size_t index) const {
+    const Slot& slot = slots.at(index);
+    const Group& group = groups[slot.group];
+    size_t n = group.vertices_num;
+    size_t i = slot.position;
+
+    double sum1 = 0;
+    double sum2 = 0;
+    for (size_t v = 0; v + 1 < n; ++v) {
+        sum1 += group.xs[v][i] * group.ys[v + 1][i];
+        sum2 += group.ys[v][i] * group.xs[v + 1][i];
+    }
+    sum1 += group.xs[n - 1][i] * group.ys[0][i];
+    sum2 += group.ys[n - 1][i] * group.xs[0][i];
+
+    return 0.5 * fabs(sum1 - sum2);
+}
+
+// Геометрический центр фигуры по индексу
+Point FigureColumns::center(size_t index) const {
+    const Slot& slot = slots.at(index);
+    const Group& group = groups[slot.group];
+    Point p;
+    for (size_t v = 0; v < group.vertices_num; ++v) {
+        p.x += group.xs[v][slot.position];
+        p.y += group.ys[v][slot.position];
+    }
+    return p / group.vertices_num;
+}
+
+// Площади всех фигур в порядке добавления
+std::vector<double> FigureColumns::areas() const {
+    std::vector<std::vector<double>> group_areas(groups.size());
+    for (size_t g = 0; g < groups.size(); ++g) {
+        group_areas[g].resize(groups[g].get_size());
+        shoelace(columns_of(groups[g].xs, groups[g].ys), group_areas[g].data());
+    }
+
+    std::vector<double> result(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        result[i] = group_areas[slots[i].group][slots[i].position];
+    }
+    return result;
+}
+
+// Центры всех фигур в порядке добавления
+std::vector<Point> FigureColumns::centers() const {
+    std::vector<std::vector<double>> cx(groups.size());
+    std::vector<std::vector<double>> cy(groups.size());
+    for (size_t g = 0; g < groups.size(); ++g) {
+        cx[g].resize(groups[g].get_size());
+        cy[g].resize(groups[g].get_size());
+        vertex_means(columns_of(groups[g].xs, groups[g].ys), cx[g].data(), cy[g].data());
+    }
+
+    std::vector<Point> result(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        result[i] = {cx[slots[i].group][slots[i].position], cy[slots[i].group][slots[i].position]};
+    }
+    return result;
+}
+
+// Общая площадь всех фигур
+double FigureColumns::total_area() const {
+    double sum = 0.0;
+    for (const auto& group : groups) {
+        if (group.get_size() > 0) {
+            sum += shoelace(columns_of(group.xs, group.ys), nullptr);
+        }
+    }
+    return sum;
+}
+
+// Аффинное преобразование всех фигур.
+// Площадь и центр не зависят от начала обхода, поэтому вершины в столбцах не переупорядочиваются
+void FigureColumns::transform(const AffineTransform& m) {
+    for (auto& group : groups) {
+        for (size_t v = 0; v < group.vertices_num; ++v) {
+            transform_columns(group.xs[v].data(), group.ys[v].data(), group.get_size(), m);
+        }
+    }
+}
+
+// Аффинное преобразование фигуры по индексу
+void FigureColumns::transform(size_t index, const AffineTransform& m) {
+    if (index >= slots.size()) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    Slot slot = slots[index];
+    Group& group = groups[slot.group];
+    for (size_t v = 0; v < group.vertices_num; ++v) {
+        transform_columns(&group.xs[v][slot.position], &group.ys[v][slot.position], 1, m);
+    }
+}
@@ -0,0 +1,200 @@
+#include "../include/figure_loader.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Разделители чисел и слов
+inline bool is_separator(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f' ||
+           c == '(' || c == ')' || c == ',';
+}
+
+// Следующее слово начиная с pos (пустое - конец текста)
+std::string_view next_token(const char*& pos, const char* end) {
+    while (pos < end && is_separator(*pos)) ++pos;
+    const char* start = pos;
+    while (pos < end && !is_separator(*pos)) ++pos;
+    return std::string_view(start, pos - start);
+}
+
+// Число вершин фигуры по названию типа (0 - не тип фигуры или число вершин задано в записи)
+size_t vertices_of(std::string_view type) {
+    if (type == "triangle") return 3;
+    if (type == "square") return 4;
+    if (type == "octagon") return 8;
+    return 0;
+}
+
+// Название типа фигуры
+bool is_type(std::string_view token) {
+    return vertices_of(token) > 0 || token == "polygon";
+}
+
+// Начало первой записи не раньше pos
+const char* record_start(const char* begin, const char* pos, const char* end) {
+    // Если pos попал внутрь слова, слово пропускается
+    while (pos > begin && pos < end && !is_separator(pos[-1])) ++pos;
+    while (pos < end) {
+        const char* token_end = pos;
+        std::string_view token = next_token(token_end, end);
+        if (is_type(token)) return token.data();
+        pos = token_end;
+    }
+    return end;
+}
+
+// Результат разбора одного куска
+struct Chunk {
+    std::vector<Figure*> figures;
+    bool failed = false;
+    std::string error;
+};
+
+// Разбор числа (допускается ведущий '+', как при чтении из потока). from_chars принимает
+// nan и inf, которые поток не читает: такие значения отвергаются, как и в load_snapshot
+bool parse_number(std::string_view token, double& value) {
+    if (!token.empty() && token[0] == '+') token.remove_prefix(1);
+    const char* last = token.data() + token.size();
+    auto [ptr, ec] = std::from_chars(token.data(), last, value);
+    return ec == std::errc() && ptr == last && !token.empty() && std::isfinite(value);
+}
+
+// Разбор n точек записи типа type
+void parse_points(const char*& pos, const char* end, std::string_view type, Point* points, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        std::string_view x = next_token(pos, end);
+        std::string_view y = next_token(pos, end);
+        if (!parse_number(x, points[i].x) || !parse_number(y, points[i].y)) {
+            throw std::invalid_argument("Invalid coordinates in " + std::string(type) + " record");
+        }
+    }
+}
+
+// Разбор записи многоугольника: число точек, затем точки
+std::vector<Point> parse_polygon(const char*& pos, const char* end) {
+    std::string_view count = next_token(pos, end);
+    size_t n = 0;
+    auto [ptr, ec] = std::from_chars(count.data(), count.data() + count.size(), n);
+    // Каждая точка занимает в тексте хотя бы два символа
+    if (ec != std::errc() || ptr != count.data() + count.size() || count.empty() || n < ConvexPolygon::MIN_VERTICES ||
+        n > ConvexPolygon::MAX_VERTICES || n > static_cast<size_t>(end - pos)) {
+        throw std::invalid_argument("Invalid vertex count in polygon record");
+    }
+    std::vector<Point> points(n);
+    parse_points(pos, end, "polygon", points.data(), n);
+    return points;
+}
+
+// Разбор записей из [pos, end) и создание фигур
+void parse_chunk(const char* pos, const char* end, Chunk& chunk) {
+    try {
+        while (true) {
+            std::string_view type = next_token(pos, end);
+            if (type.empty()) break;
+            if (type == "polygon") {
+                chunk.figures.push_back(new ConvexPolygon(parse_polygon(pos, end)));
+                continue;
+            }
+            size_t n = vertices_of(type);
+            if (n == 0) continue;
+
+            Point points[8];
+            parse_points(pos, end, type, points, n);
+            if (n == 3) {
+                chunk.figures.push_back(new Triangle(points));
+            } else if (n == 4) {
+                chunk.figures.push_back(new Square(points));
+            } else {
+                chunk.figures.push_back(new Octagon(points));
+            }
+        }
+    } catch (const std::exception& e) {
+        chunk.failed = true;
+        chunk.error = e.what();
+    }
+}
+
+} // namespace
+
+// Разбор текста
+size_t parse_figures(FigureArray& arr, std::string_view text, size_t threads) {
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    threads = std::max<size_t>(1, std::min(threads, text.size() / 4096 + 1));
+
+    // Границы кусков сдвигаются к началу ближайшей записи
+    std::vector<const char*> bounds(threads + 1);
+    bounds[0] = begin;
+    bounds[threads] = end;
+    for (size_t t = 1; t < threads; ++t) {
+        bounds[t] = record_start(begin, std::max(bounds[t - 1], begin + text.size() * t / threads), end);
+    }
+
+    std::vector<Chunk> chunks(threads);
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        workers.emplace_back(parse_chunk, bounds[t], bounds[t + 1], std::ref(chunks[t]));
+    }
+    parse_chunk(bounds[0], bounds[1], chunks[0]);
+    for (auto& worker : workers) worker.join();
+
+    // Ошибка в любом куске - созданные фигуры удаляются, сообщается первая по тексту ошибка
+    for (const auto& chunk : chunks) {
+        if (chunk.failed) {
+            for (auto& other : chunks) {
+                for (auto f : other.figures) delete f;
+            }
+            throw std::invalid_argument(chunk.error);
+        }
+    }
+
+    size_t total = 0;
+    for (const auto& chunk : chunks) total += chunk.figures.size();
+    arr.resize(arr.get_size() + total);
+    for (const auto& chunk : chunks) {
+        for (auto f : chunk.figures) arr.add(*f);
+    }
+    return total;
+}
+
+// Загрузка файла
+size_t load_figures(FigureArray& arr, const std::string& path, size_t threads) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("Cannot read file: " + path);
+    }
+    size_t length = static_cast<size_t>(info.st_size);
+    if (length == 0) {
+        close(fd);
+        return 0;
+    }
+
+    void* data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("Cannot map file: " + path);
+    }
+    madvise(data, length, MADV_SEQUENTIAL);
+
+    try {
+        size_t added = parse_figures(arr, std::string_view(static_cast<const char*>(data), length), threads);
+        munmap(data, length);
+        return added;
+    } catch (...) {
+        munmap(data, length);
+        throw;
+    }
+}
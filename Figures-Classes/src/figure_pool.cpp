@@ -0,0 +1,55 @@
+#include "../include/figure_pool.hpp"
+#include <new>
+
+// Деструктор
+FigurePool::~FigurePool() {
+    for (void* page : pages) {
+        ::operator delete(page);
+    }
+}
+
+// Выделение блока
+void* FigurePool::allocate(size_t bytes) {
+    if (bytes > MAX_BLOCK) {
+        ++used;
+        return ::operator new(bytes);
+    }
+
+    size_t index = bytes == 0 ? 0 : (bytes - 1) / GRANULE;
+    SizeClass& sc = classes[index];
+    if (sc.free != nullptr) {
+        FreeBlock* block = sc.free;
+        sc.free = block->next;
+        ++used;
+        return block;
+    }
+
+    // Свободных блоков нет - размечаем следующий блок страницы, при нехватке берем новую
+    size_t block_size = (index + 1) * GRANULE;
+    if (sc.next == sc.end) {
+        pages.reserve(pages.size() + 1);
+        std::byte* page = static_cast<std::byte*>(::operator new(PAGE_SIZE));
+        pages.push_back(page);
+        sc.next = page;
+        sc.end = page + PAGE_SIZE / block_size * block_size;
+    }
+    void* block = sc.next;
+    sc.next += block_size;
+    ++used;
+    return block;
+}
+
+// Возврат блока
+void FigurePool::deallocate(void* p, size_t bytes) {
+    if (p == nullptr) return;
+    --used;
+    if (bytes > MAX_BLOCK) {
+        ::operator delete(p);
+        return;
+    }
+
+    SizeClass& sc = classes[bytes == 0 ? 0 : (bytes - 1) / GRANULE];
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    block->next = sc.free;
+    sc.free = block;
+}
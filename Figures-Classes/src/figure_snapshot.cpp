@@ -0,0 +1,247 @@
+#include "../include/figure_snapshot.hpp"
+#include "../include/vertex_order.hpp"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t figures;
+    uint64_t vertices;
+};
+
+struct RecordHeader {
+    uint32_t tag;
+    uint32_t vertices;
+};
+
+static_assert(sizeof(SnapshotHeader) == 32 && sizeof(RecordHeader) == 8);
+static_assert(sizeof(Point) == 2 * sizeof(double));
+
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+// Размер буфера записи
+constexpr size_t WRITE_BUFFER = 1 << 20;
+
+// Тег по типу фигуры
+SnapshotTag tag_of(const Figure& f) {
+    std::string type = f.type();
+    if (type == "triangle") return SnapshotTag::Triangle;
+    if (type == "square") return SnapshotTag::Square;
+    if (type == "octagon") return SnapshotTag::Octagon;
+    if (type == "polygon") return SnapshotTag::Polygon;
+    throw std::invalid_argument("Unsupported figure type: " + type);
+}
+
+// Число вершин фигуры с тегом tag (0 - тег неизвестен, многоугольник проверяется отдельно)
+size_t vertices_of(uint32_t tag) {
+    switch (static_cast<SnapshotTag>(tag)) {
+        case SnapshotTag::Triangle: return 3;
+        case SnapshotTag::Square: return 4;
+        case SnapshotTag::Octagon: return 8;
+        default: return 0;
+    }
+}
+
+// Сохраненные вершины идут по обходу: псевдоугол вокруг центра при проходе по вершинам
+// циклически убывает ровно один раз (обход против часовой стрелки) или ровно один раз растет
+// (по часовой). Одних знаков поворотов мало: у восьмиугольника, записанного звездой
+// (вершины 0, 3, 6, 1, 4, 7, 2, 5), они одинаковы, но обход трижды огибает центр
+bool in_traversal_order(const Figure& f) {
+    size_t n = f.get_vertices_num();
+    const Point* v = f.get_vertices();
+    Point c = f.center();
+    auto key = [&](size_t i) { return pseudo_angle(v[i].x - c.x, v[i].y - c.y); };
+
+    size_t descents = 0;
+    size_t ascents = 0;
+    double first = key(0);
+    double previous = first;
+    for (size_t i = 1; i <= n; ++i) {
+        double current = i < n ? key(i) : first;
+        descents += current < previous;
+        ascents += current > previous;
+        previous = current;
+    }
+    return descents == 1 || ascents == 1;
+}
+
+// Вид фигуры проверяется без переупорядочивания вершин: порядок обхода, выпуклость,
+// ненулевая площадь, для квадрата - isSquare
+bool valid_shape(const Figure& f, SnapshotTag tag) {
+    if (!f.isConvex() || !(static_cast<double>(f) > 0.0) || !in_traversal_order(f)) return false;
+    return tag != SnapshotTag::Square || static_cast<const Square&>(f).isSquare();
+}
+
+// Отображение файла в память только для чтения
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw std::runtime_error("Cannot read file: " + path);
+        }
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("Cannot map file: " + path);
+        }
+        if (length > 0) madvise(data, length, MADV_SEQUENTIAL);
+    }
+
+    ~MappedFile() {
+        if (length > 0) munmap(data, length);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* begin() const { return static_cast<const char*>(data); }
+    size_t size() const { return length; }
+
+private:
+    void* data = nullptr;
+    size_t length = 0;
+};
+
+} // namespace
+
+// Сохранение снимка
+void save_snapshot(const FigureArray& arr, const std::string& path) {
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = BYTE_ORDER_MARK;
+    header.figures = arr.get_size();
+
+    // Теги определяются до открытия файла, чтобы неизвестный тип не оставил недописанный снимок
+    std::vector<uint32_t> tags(arr.get_size());
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        tags[i] = static_cast<uint32_t>(tag_of(arr.get(i)));
+        header.vertices += arr.get(i).get_vertices_num();
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+
+    // Записи собираются в буфер и сбрасываются в файл крупными кусками
+    std::vector<char> buffer;
+    buffer.reserve(WRITE_BUFFER);
+    auto append = [&](const void* bytes, size_t n) {
+        if (buffer.size() + n > WRITE_BUFFER && !buffer.empty()) {
+            out.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+        const char* p = static_cast<const char*>(bytes);
+        buffer.insert(buffer.end(), p, p + n);
+    };
+
+    append(&header, sizeof(header));
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        const Figure& f = arr.get(i);
+        RecordHeader record{tags[i], static_cast<uint32_t>(f.get_vertices_num())};
+        append(&record, sizeof(record));
+        append(f.get_vertices(), f.get_vertices_num() * sizeof(Point));
+    }
+    out.write(buffer.data(), buffer.size());
+    out.close();
+    if (!out) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+}
+
+// Загрузка снимка
+size_t load_snapshot(FigureArray& arr, const std::string& path) {
+    MappedFile file(path);
+    const char* pos = file.begin();
+    const char* end = pos + file.size();
+
+    SnapshotHeader header;
+    if (file.size() < sizeof(header)) {
+        throw std::invalid_argument("Not a figure snapshot: " + path);
+    }
+    std::memcpy(&header, pos, sizeof(header));
+    pos += sizeof(header);
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) {
+        throw std::invalid_argument("Not a figure snapshot: " + path);
+    }
+    if (header.version != SNAPSHOT_VERSION) {
+        throw std::invalid_argument("Unsupported snapshot version " + std::to_string(header.version));
+    }
+    if (header.byte_order != BYTE_ORDER_MARK) {
+        throw std::invalid_argument("Unsupported snapshot byte order");
+    }
+    // Размер файла однозначно задается числом фигур и вершин
+    size_t remaining = static_cast<size_t>(end - pos);
+    if (header.figures > remaining / sizeof(RecordHeader) || header.vertices > remaining / sizeof(Point) ||
+        header.figures * sizeof(RecordHeader) + header.vertices * sizeof(Point) != remaining) {
+        throw std::invalid_argument("Truncated or corrupted snapshot: " + path);
+    }
+
+    size_t before = arr.get_size();
+    arr.resize(before + header.figures);
+    FigurePool& pool = arr.get_pool();
+    Figure* f = nullptr;
+    try {
+        for (uint64_t i = 0; i < header.figures; ++i) {
+            RecordHeader record;
+            if (static_cast<size_t>(end - pos) < sizeof(record)) {
+                throw std::invalid_argument("Truncated or corrupted snapshot: " + path);
+            }
+            std::memcpy(&record, pos, sizeof(record));
+            pos += sizeof(record);
+
+            size_t n = record.vertices;
+            size_t expected = vertices_of(record.tag);
+            bool polygon = record.tag == static_cast<uint32_t>(SnapshotTag::Polygon);
+            if ((polygon && n < 3) || (!polygon && (expected == 0 || n != expected)) ||
+                n > static_cast<size_t>(end - pos) / sizeof(Point)) {
+                throw std::invalid_argument("Invalid figure record " + std::to_string(i) + " in snapshot");
+            }
+            const Point* points = reinterpret_cast<const Point*>(pos);
+            for (size_t v = 0; v < n; ++v) {
+                if (!std::isfinite(points[v].x) || !std::isfinite(points[v].y)) {
+                    throw std::invalid_argument("Invalid coordinates in figure record " + std::to_string(i));
+                }
+            }
+
+            switch (static_cast<SnapshotTag>(record.tag)) {
+                case SnapshotTag::Triangle: f = new (pool) Triangle(pool); break;
+                case SnapshotTag::Square: f = new (pool) Square(pool); break;
+                case SnapshotTag::Octagon: f = new (pool) Octagon(pool); break;
+                default: f = new (pool) ConvexPolygon(pool); break;
+            }
+            f->assign_vertices(points, n);
+            if (!valid_shape(*f, static_cast<SnapshotTag>(record.tag))) {
+                throw std::invalid_argument("Invalid figure shape in record " + std::to_string(i) + " of snapshot");
+            }
+            pos += n * sizeof(Point);
+            arr.add(*f);
+            f = nullptr;
+        }
+    } catch (...) {
+        delete f;
+        while (arr.get_size() > before) arr.pop(arr.get_size() - 1);
+        throw;
+    }
+    return header.figures;
+}
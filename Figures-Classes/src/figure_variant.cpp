@@ -0,0 +1,114 @@
+#include "../include/figure_variant.hpp"
+#include "../include/triangle.hpp"
+#include "../include/square.hpp"
+#include "../include/octagon.hpp"
+
+namespace {
+
+// Копирование вершин фигуры в значение
+template <size_t N>
+PolygonValue<N> copy_vertices(const Figure& f) {
+    PolygonValue<N> value;
+    std::copy(f.get_vertices(), f.get_vertices() + N, value.vertices.begin());
+    return value;
+}
+
+// Фигура нужного класса по значению (конструкторы фигур принимают изменяемый массив)
+Figure* make_figure(TriangleValue value) { return new Triangle(value.vertices.data()); }
+Figure* make_figure(SquareValue value) { return new Square(value.vertices.data()); }
+Figure* make_figure(OctagonValue value) { return new Octagon(value.vertices.data()); }
+
+} // namespace
+
+// Значение по фигуре
+FigureValue to_value(const Figure& f) {
+    if (dynamic_cast<const Triangle*>(&f) != nullptr) return copy_vertices<3>(f);
+    if (dynamic_cast<const Square*>(&f) != nullptr) return copy_vertices<4>(f);
+    if (dynamic_cast<const Octagon*>(&f) != nullptr) return copy_vertices<8>(f);
+    throw std::invalid_argument("Unsupported figure type");
+}
+
+// Фигура по значению
+Figure* to_figure(const FigureValue& value) {
+    return std::visit([](const auto& f) { return make_figure(f); }, value);
+}
+
+// Конструктор по массиву фигур
+FigureValueArray::FigureValueArray(const FigureArray& arr) {
+    figures.reserve(arr.get_size());
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        figures.push_back(to_value(arr.get(i)));
+    }
+}
+
+// Добавление в конец
+void FigureValueArray::add(const FigureValue& value) {
+    figures.push_back(value);
+}
+
+void FigureValueArray::add(const Figure& f) {
+    figures.push_back(to_value(f));
+}
+
+// Удаление по индексу
+void FigureValueArray::pop(size_t index) {
+    if (index >= figures.size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    figures.erase(figures.begin() + index);
+}
+
+// Удаление всех фигур
+void FigureValueArray::clear() {
+    figures.clear();
+}
+
+// Печатаем геометрический центр всех фигур
+void FigureValueArray::array_center() const {
+    for (const auto& f : figures) {
+        std::cout << center(f) << std::endl;
+    }
+}
+
+// Печатаем площадь всех фигур
+void FigureValueArray::array_square() const {
+    for (const auto& f : figures) {
+        std::cout << area(f) << std::endl;
+    }
+}
+
+// Площади всех фигур
+std::vector<double> FigureValueArray::areas() const {
+    std::vector<double> result(figures.size());
+    for (size_t i = 0; i < figures.size(); ++i) {
+        result[i] = area(figures[i]);
+    }
+    return result;
+}
+
+// Центры всех фигур
+std::vector<Point> FigureValueArray::centers() const {
+    std::vector<Point> result(figures.size());
+    for (size_t i = 0; i < figures.size(); ++i) {
+        result[i] = center(figures[i]);
+    }
+    return result;
+}
+
+// Общая площадь всех фигур
+double FigureValueArray::total_area() const {
+    double sum = 0.0;
+    for (const auto& f : figures) {
+        sum += area(f);
+    }
+    return sum;
+}
+
+// Перенос в FigureArray
+FigureArray FigureValueArray::to_array() const {
+    FigureArray arr(figures.size());
+    for (const auto& f : figures) {
+        arr.add(*to_figure(f));
+    }
+    return arr;
+}
@@ -3,14 +3,19 @@
 // Конструкторы
 Octagon::Octagon() : Figure(OCTAGON_VERTICES) {}
 
-Octagon::Octagon(Point* verts) : Figure(OCTAGON_VERTICES, verts) {
+Octagon::Octagon(Point* verts) : Octagon(verts, nullptr) {}
+
+Octagon::Octagon(FigurePool& pool) : Figure(OCTAGON_VERTICES, &pool) {}
+
+Octagon::Octagon(Point* verts, FigurePool& pool) : Octagon(verts, &pool) {}
+
+Octagon::Octagon(Point* verts, FigurePool* pool) : Figure(OCTAGON_VERTICES, verts, pool) {
     if (!isConvex()) {
         throw std::invalid_argument("Octagon is not convex");
     }
     if (static_cast<double>(*this) == 0.0) {
         throw std::invalid_argument("Degenerate octagon");
     }
-    this->sortVertices();
 }
 
 // Конструктор копирования
@@ -41,6 +46,7 @@ void Octagon::read(std::istream& in) {
     for (size_t i = 0; i < OCTAGON_VERTICES; ++i) {
         in >> this->vertices[i];
     }
+    this->sortVertices();
 
     if (!isConvex()) {
         throw std::invalid_argument("Octagon is not convex");
@@ -48,7 +54,6 @@ void Octagon::read(std::istream& in) {
     if (static_cast<double>(*this) == 0.0) {
         throw std::invalid_argument("Degenerate octagon");
     }
-    this->sortVertices();
 }
 
 void Octagon::write(std::ostream& out) const {
@@ -0,0 +1,185 @@
+#include "../include/overlap.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+// Удвоенная ориентированная площадь многоугольника
+double signed_area2(const std::vector<Point>& poly) {
+    double sum = 0.0;
+    for (size_t i = 0; i < poly.size(); ++i) {
+        const Point& a = poly[i];
+        const Point& b = poly[(i + 1) % poly.size()];
+        sum += a.x * b.y - a.y * b.x;
+    }
+    return sum;
+}
+
+// Вершины фигуры в обходе против часовой стрелки
+std::vector<Point> counter_clockwise(const Figure& f) {
+    std::vector<Point> poly(f.get_vertices(), f.get_vertices() + f.get_vertices_num());
+    if (signed_area2(poly) < 0) std::reverse(poly.begin(), poly.end());
+    return poly;
+}
+
+// Положение точки относительно направленного ребра (a, b): > 0 - слева
+double side(const Point& a, const Point& b, const Point& p) {
+    return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+}
+
+// Отсечение многоугольника subject выпуклым многоугольником clip (оба против часовой стрелки).
+// Результат остается в result, scratch - рабочий буфер; буферы переиспользуются между вызовами
+void clip_polygon(const std::vector<Point>& subject, const std::vector<Point>& clip,
+                  std::vector<Point>& result, std::vector<Point>& scratch) {
+    result.assign(subject.begin(), subject.end());
+    for (size_t e = 0; e < clip.size() && !result.empty(); ++e) {
+        const Point& a = clip[e];
+        const Point& b = clip[(e + 1) % clip.size()];
+        scratch.swap(result);
+        result.clear();
+
+        // Остается часть слева от ребра, на пересечениях со стороной добавляются новые вершины
+        for (size_t i = 0; i < scratch.size(); ++i) {
+            const Point& p = scratch[i];
+            const Point& q = scratch[(i + 1) % scratch.size()];
+            double sp = side(a, b, p);
+            double sq = side(a, b, q);
+            if (sp >= 0) result.push_back(p);
+            if ((sp > 0 && sq < 0) || (sp < 0 && sq > 0)) {
+                double t = sp / (sp - sq);
+                result.push_back({p.x + t * (q.x - p.x), p.y + t * (q.y - p.y)});
+            }
+        }
+    }
+}
+
+// Узкая фаза для пары: площадь пересечения
+double overlap_area(const std::vector<Point>& a, const std::vector<Point>& b,
+                    std::vector<Point>& result, std::vector<Point>& scratch) {
+    clip_polygon(a, b, result, scratch);
+    return result.size() < 3 ? 0.0 : 0.5 * std::fabs(signed_area2(result));
+}
+
+} // namespace
+
+// Многоугольник пересечения
+std::vector<Point> intersection(const Figure& a, const Figure& b) {
+    if (!a.bounding_box().overlaps(b.bounding_box())) return {};
+    std::vector<Point> poly;
+    std::vector<Point> scratch;
+    clip_polygon(counter_clockwise(a), counter_clockwise(b), poly, scratch);
+    if (poly.size() < 3) poly.clear();
+    return poly;
+}
+
+// Площадь пересечения
+double intersection_area(const Figure& a, const Figure& b) {
+    if (!a.bounding_box().overlaps(b.bounding_box())) return 0.0;
+    std::vector<Point> result;
+    std::vector<Point> scratch;
+    return overlap_area(counter_clockwise(a), counter_clockwise(b), result, scratch);
+}
+
+// Поиск всех пересекающихся пар
+std::vector<FigureOverlap> find_overlaps(const FigureArray& arr, size_t threads) {
+    size_t n = arr.get_size();
+    std::vector<BoundingBox> boxes(n);
+    std::vector<std::vector<Point>> polygons(n);
+    for (size_t i = 0; i < n; ++i) {
+        boxes[i] = arr.get(i).bounding_box();
+        polygons[i] = counter_clockwise(arr.get(i));
+    }
+
+    // Широкая фаза. Плоскость делится на горизонтальные полосы высотой в две средние высоты
+    // прямоугольника, фигура попадает во все полосы, которые пересекает (в среднем в полторы).
+    // Внутри полосы прямоугольники упорядочены по левой границе, и каждый сравнивается только
+    // со следующими за ним, начинающимися не правее его правой границы
+    double low = 0.0, high = 0.0, heights = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        low = i == 0 ? boxes[i].min.y : std::min(low, boxes[i].min.y);
+        high = i == 0 ? boxes[i].max.y : std::max(high, boxes[i].max.y);
+        heights += boxes[i].max.y - boxes[i].min.y;
+    }
+    constexpr size_t MAX_BANDS = 4096;
+    size_t bands = 1;
+    if (heights > 0) {
+        double count = (high - low) / (2.0 * heights / n);
+        bands = static_cast<size_t>(std::clamp(count, 1.0, static_cast<double>(std::min(n, MAX_BANDS))));
+    }
+    double band_height = (high - low) / bands;
+    auto band_of = [&](double y) {
+        if (band_height <= 0) return size_t(0);
+        return std::min(bands - 1, static_cast<size_t>((y - low) / band_height));
+    };
+
+    // Раскладка фигур по полосам подсчетом, затем сортировка каждой полосы
+    std::vector<size_t> band_offsets(bands + 1, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t b = band_of(boxes[i].min.y); b <= band_of(boxes[i].max.y); ++b) ++band_offsets[b + 1];
+    }
+    for (size_t b = 0; b < bands; ++b) band_offsets[b + 1] += band_offsets[b];
+    std::vector<size_t> order(band_offsets[bands]);
+    std::vector<size_t> fill(band_offsets.begin(), band_offsets.end() - 1);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t b = band_of(boxes[i].min.y); b <= band_of(boxes[i].max.y); ++b) order[fill[b]++] = i;
+    }
+    for (size_t b = 0; b < bands; ++b) {
+        std::sort(order.begin() + band_offsets[b], order.begin() + band_offsets[b + 1],
+                  [&](size_t x, size_t y) { return boxes[x].min.x < boxes[y].min.x; });
+    }
+
+    // Прямоугольники в порядке order в отдельных массивах по координатам
+    size_t entries = order.size();
+    std::vector<double> min_x(entries), max_x(entries), min_y(entries), max_y(entries);
+    std::vector<size_t> band(entries);
+    for (size_t b = 0; b < bands; ++b) {
+        for (size_t k = band_offsets[b]; k < band_offsets[b + 1]; ++k) {
+            const BoundingBox& box = boxes[order[k]];
+            min_x[k] = box.min.x;
+            max_x[k] = box.max.x;
+            min_y[k] = box.min.y;
+            max_y[k] = box.max.y;
+            band[k] = b;
+        }
+    }
+
+    // Каждый поток проходит свой кусок order. Пара, попавшая в несколько полос, учитывается
+    // только в полосе большей из нижних границ. Отсекается фигура с меньшим индексом,
+    // как в intersection_area(arr.get(first), arr.get(second))
+    auto sweep = [&](size_t begin, size_t end, std::vector<FigureOverlap>& out) {
+        std::vector<Point> result;
+        std::vector<Point> scratch;
+        for (size_t k = begin; k < end; ++k) {
+            size_t last = band_offsets[band[k] + 1];
+            for (size_t m = k + 1; m < last && min_x[m] <= max_x[k]; ++m) {
+                if (min_y[k] > max_y[m] || min_y[m] > max_y[k]) continue;
+                size_t i = std::min(order[k], order[m]);
+                size_t j = std::max(order[k], order[m]);
+                if (band[k] != band_of(std::max(min_y[k], min_y[m]))) continue;
+                double area = overlap_area(polygons[i], polygons[j], result, scratch);
+                if (area > 0) out.push_back({i, j, area});
+            }
+        }
+    };
+
+    constexpr size_t MIN_CHUNK = 1024;
+    threads = std::max<size_t>(1, std::min(threads, (entries + MIN_CHUNK - 1) / MIN_CHUNK));
+    size_t chunk = (entries + threads - 1) / threads;
+    std::vector<std::vector<FigureOverlap>> parts(threads);
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        size_t begin = std::min(entries, t * chunk);
+        size_t end = std::min(entries, begin + chunk);
+        workers.emplace_back(sweep, begin, end, std::ref(parts[t]));
+    }
+    sweep(0, std::min(entries, chunk), parts[0]);
+    for (auto& worker : workers) worker.join();
+
+    std::vector<FigureOverlap> result;
+    for (const auto& part : parts) result.insert(result.end(), part.begin(), part.end());
+    std::sort(result.begin(), result.end(), [](const FigureOverlap& a, const FigureOverlap& b) {
+        return a.first != b.first ? a.first < b.first : a.second < b.second;
+    });
+    return result;
+}
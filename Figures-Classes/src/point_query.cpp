@@ -0,0 +1,348 @@
+#include "../include/point_query.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define POINT_QUERY_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+using Edge = PointQueryEngine::Edge;
+
+// Число точек, проверяемых за раз
+constexpr size_t LANES = 4;
+
+// Проверка 4 точек (xs[k], ys[k]) на принадлежность фигуре, бит k результата - точка k внутри.
+// Векторное произведение считается так же, как в Figure::contains (у фигур с обходом по часовой
+// стрелке направления ребер обращены, что точно меняет его знак), поэтому ответы совпадают
+unsigned test_scalar(const Edge* edges, size_t n, const BoundingBox& box, const double* xs, const double* ys) {
+    unsigned mask = 0;
+    for (size_t k = 0; k < LANES; ++k) {
+        double x = xs[k];
+        double y = ys[k];
+        if (!(box.min.x <= x && x <= box.max.x && box.min.y <= y && y <= box.max.y)) continue;
+
+        bool inside = true;
+        for (size_t i = 0; i < n && inside; ++i) {
+            double cross = edges[i].ex * (y - edges[i].ay) - edges[i].ey * (x - edges[i].ax);
+            inside = cross >= 0;
+        }
+        mask |= unsigned(inside) << k;
+    }
+    return mask;
+}
+
+#ifdef POINT_QUERY_AVX2
+
+__attribute__((target("avx2")))
+unsigned test_avx2(const Edge* edges, size_t n, const BoundingBox& box, const double* xs, const double* ys) {
+    const __m256d x = _mm256_loadu_pd(xs);
+    const __m256d y = _mm256_loadu_pd(ys);
+    const __m256d zero = _mm256_setzero_pd();
+
+    __m256d inside = _mm256_and_pd(
+        _mm256_and_pd(_mm256_cmp_pd(_mm256_set1_pd(box.min.x), x, _CMP_LE_OQ),
+                      _mm256_cmp_pd(x, _mm256_set1_pd(box.max.x), _CMP_LE_OQ)),
+        _mm256_and_pd(_mm256_cmp_pd(_mm256_set1_pd(box.min.y), y, _CMP_LE_OQ),
+                      _mm256_cmp_pd(y, _mm256_set1_pd(box.max.y), _CMP_LE_OQ)));
+
+    for (size_t i = 0; i < n && _mm256_movemask_pd(inside) != 0; ++i) {
+        __m256d dy = _mm256_sub_pd(y, _mm256_set1_pd(edges[i].ay));
+        __m256d dx = _mm256_sub_pd(x, _mm256_set1_pd(edges[i].ax));
+        __m256d cross = _mm256_sub_pd(_mm256_mul_pd(_mm256_set1_pd(edges[i].ex), dy),
+                                      _mm256_mul_pd(_mm256_set1_pd(edges[i].ey), dx));
+        inside = _mm256_and_pd(inside, _mm256_cmp_pd(cross, zero, _CMP_GE_OQ));
+    }
+    return static_cast<unsigned>(_mm256_movemask_pd(inside));
+}
+
+#endif
+
+// Выбор реализации по возможностям процессора
+using TestFunc = unsigned (*)(const Edge*, size_t, const BoundingBox&, const double*, const double*);
+
+TestFunc select_test() {
+#ifdef POINT_QUERY_AVX2
+    if (__builtin_cpu_supports("avx2")) return test_avx2;
+#endif
+    return test_scalar;
+}
+
+} // namespace
+
+// Конструкторы
+PointQueryEngine::PointQueryEngine()
+    : figures_num(0), bounds{}, grid_size(1), cell_width(1.0), cell_height(1.0), cell_offsets(2, 0) {}
+
+PointQueryEngine::PointQueryEngine(const FigureArray& arr) : PointQueryEngine() {
+    build(arr);
+}
+
+// Построение: сетка по прямоугольникам фигур, затем ребра в порядке ячеек и раскладка по ячейкам
+void PointQueryEngine::build(const FigureArray& arr) {
+    figures_num = arr.get_size();
+    std::vector<BoundingBox> boxes(figures_num);
+    for (size_t i = 0; i < figures_num; ++i) boxes[i] = arr.get(i).bounding_box();
+
+    // Сетка примерно с одной фигурой на ячейку
+    grid_size = std::clamp<size_t>(static_cast<size_t>(std::sqrt(static_cast<double>(figures_num))), 1, 1024);
+    bounds = figures_num > 0 ? boxes[0] : BoundingBox{};
+    for (const auto& box : boxes) bounds = bounds.merge(box);
+    cell_width = std::max((bounds.max.x - bounds.min.x) / grid_size, std::numeric_limits<double>::min());
+    cell_height = std::max((bounds.max.y - bounds.min.y) / grid_size, std::numeric_limits<double>::min());
+
+    auto cell_range = [&](const BoundingBox& box, size_t& x0, size_t& x1, size_t& y0, size_t& y1) {
+        auto clamp = [&](double v) { return std::min(grid_size - 1, static_cast<size_t>(std::max(0.0, v))); };
+        x0 = clamp((box.min.x - bounds.min.x) / cell_width);
+        x1 = clamp((box.max.x - bounds.min.x) / cell_width);
+        y0 = clamp((box.min.y - bounds.min.y) / cell_height);
+        y1 = clamp((box.max.y - bounds.min.y) / cell_height);
+    };
+
+    // Ребра фигур кладутся в порядке ячеек их левого нижнего угла (сортировка подсчетом)
+    std::vector<size_t> first_cell(figures_num);
+    std::vector<size_t> order_offsets(grid_size * grid_size + 1, 0);
+    for (size_t i = 0; i < figures_num; ++i) {
+        size_t x0, x1, y0, y1;
+        cell_range(boxes[i], x0, x1, y0, y1);
+        first_cell[i] = y0 * grid_size + x0;
+        ++order_offsets[first_cell[i] + 1];
+    }
+    for (size_t c = 0; c < grid_size * grid_size; ++c) order_offsets[c + 1] += order_offsets[c];
+    std::vector<size_t> order(figures_num);
+    for (size_t i = 0; i < figures_num; ++i) order[order_offsets[first_cell[i]]++] = i;
+
+    // Ребра считаются в порядке массива (фигуры лежат в памяти подряд), затем переставляются
+    std::vector<size_t> offsets(figures_num + 1, 0);
+    for (size_t i = 0; i < figures_num; ++i) offsets[i + 1] = offsets[i] + arr.get(i).get_vertices_num();
+    if (offsets.back() > UINT32_MAX) {
+        throw std::length_error("Too many edges for PointQueryEngine");
+    }
+
+    std::vector<Edge> by_figure(offsets.back());
+    for (size_t i = 0; i < figures_num; ++i) {
+        const Figure& f = arr.get(i);
+        const Point* verts = f.get_vertices();
+        size_t m = f.get_vertices_num();
+
+        double orientation = 0.0;
+        for (size_t v = 0; v < m; ++v) {
+            orientation += verts[v].x * verts[(v + 1) % m].y - verts[v].y * verts[(v + 1) % m].x;
+        }
+        double sign = orientation < 0 ? -1.0 : 1.0;
+
+        for (size_t v = 0; v < m; ++v) {
+            const Point& a = verts[v];
+            const Point& b = verts[(v + 1) % m];
+            by_figure[offsets[i] + v] = {a.x, a.y, sign * (b.x - a.x), sign * (b.y - a.y)};
+        }
+    }
+
+    edges.resize(by_figure.size());
+    std::vector<uint32_t> edges_begin(figures_num);
+    size_t next = 0;
+    for (size_t i : order) {
+        edges_begin[i] = static_cast<uint32_t>(next);
+        std::copy(by_figure.begin() + offsets[i], by_figure.begin() + offsets[i + 1], edges.begin() + next);
+        next += offsets[i + 1] - offsets[i];
+    }
+
+    // Фигура попадает во все ячейки своего прямоугольника, если их не больше MAX_FIGURE_CELLS,
+    // иначе - в список больших фигур; два прохода: подсчет и заполнение
+    std::vector<bool> large(figures_num);
+    large_entries.clear();
+    cell_offsets.assign(grid_size * grid_size + 1, 0);
+    for (size_t i = 0; i < figures_num; ++i) {
+        size_t x0, x1, y0, y1;
+        cell_range(boxes[i], x0, x1, y0, y1);
+        if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_FIGURE_CELLS) {
+            large[i] = true;
+            large_entries.push_back({boxes[i], i, edges_begin[i], static_cast<uint32_t>(offsets[i + 1] - offsets[i])});
+            continue;
+        }
+        for (size_t cy = y0; cy <= y1; ++cy) {
+            for (size_t cx = x0; cx <= x1; ++cx) ++cell_offsets[cy * grid_size + cx + 1];
+        }
+    }
+    for (size_t c = 0; c < grid_size * grid_size; ++c) cell_offsets[c + 1] += cell_offsets[c];
+
+    // Заполнение в порядке ячеек фигур, чтобы запись шла подряд; затем кандидаты ячейки
+    // упорядочиваются по индексу фигуры
+    cell_entries.resize(cell_offsets.back());
+    std::vector<size_t> fill(cell_offsets.begin(), cell_offsets.end() - 1);
+    for (size_t i : order) {
+        if (large[i]) continue;
+        size_t x0, x1, y0, y1;
+        cell_range(boxes[i], x0, x1, y0, y1);
+        uint32_t edges_num = static_cast<uint32_t>(offsets[i + 1] - offsets[i]);
+        for (size_t cy = y0; cy <= y1; ++cy) {
+            for (size_t cx = x0; cx <= x1; ++cx) {
+                cell_entries[fill[cy * grid_size + cx]++] = {boxes[i], i, edges_begin[i], edges_num};
+            }
+        }
+    }
+    for (size_t c = 0; c < grid_size * grid_size; ++c) {
+        std::sort(cell_entries.begin() + cell_offsets[c], cell_entries.begin() + cell_offsets[c + 1],
+                  [](const CellEntry& a, const CellEntry& b) { return a.figure < b.figure; });
+    }
+}
+
+// Ячейка точки
+size_t PointQueryEngine::cell_of(double x, double y) const {
+    if (figures_num == 0 || !bounds.contains({x, y})) return NOT_FOUND;
+    size_t cx = std::min(grid_size - 1, static_cast<size_t>((x - bounds.min.x) / cell_width));
+    size_t cy = std::min(grid_size - 1, static_cast<size_t>((y - bounds.min.y) / cell_height));
+    return cy * grid_size + cx;
+}
+
+// Одна точка
+size_t PointQueryEngine::query(const Point& p) const {
+    size_t c = cell_of(p.x, p.y);
+    if (c == NOT_FOUND) return NOT_FOUND;
+
+    double xs[LANES] = {p.x, p.x, p.x, p.x};
+    double ys[LANES] = {p.y, p.y, p.y, p.y};
+    auto test_entry = [&](const CellEntry& entry) {
+        return entry.box.contains(p) && test_scalar(edges.data() + entry.edges_begin, entry.edges_num, entry.box, xs, ys) != 0;
+    };
+
+    // Первая фигура в ячейке и первая большая фигура; ответ - меньший индекс
+    size_t result = NOT_FOUND;
+    for (size_t k = cell_offsets[c]; k < cell_offsets[c + 1]; ++k) {
+        if (test_entry(cell_entries[k])) {
+            result = cell_entries[k].figure;
+            break;
+        }
+    }
+    for (const CellEntry& entry : large_entries) {
+        if (entry.figure > result) break;
+        if (test_entry(entry)) return entry.figure;
+    }
+    return result;
+}
+
+// Набор точек: непрерывные куски по потокам
+std::vector<size_t> PointQueryEngine::query(std::span<const Point> points, size_t threads) const {
+    std::vector<size_t> result(points.size(), NOT_FOUND);
+    constexpr size_t MIN_CHUNK = 4096;
+    threads = std::max<size_t>(1, std::min(threads, (points.size() + MIN_CHUNK - 1) / MIN_CHUNK));
+    size_t chunk = (points.size() + threads - 1) / threads;
+
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        size_t begin = std::min(points.size(), t * chunk);
+        size_t end = std::min(points.size(), begin + chunk);
+        workers.emplace_back([this, &points, &result, begin, end] {
+            query_range(points.data() + begin, end - begin, result.data() + begin);
+        });
+    }
+    query_range(points.data(), std::min(points.size(), chunk), result.data());
+    for (auto& worker : workers) worker.join();
+    return result;
+}
+
+// Точки куска раскладываются подсчетом сначала по квадратным блокам TILE x TILE ячеек, затем внутри
+// блока по ячейкам: так раскладка не прыгает по всей сетке. В каждой ячейке группы по 4 точки
+// проверяются с фигурами-кандидатами по возрастанию индекса, пока все точки группы не найдут фигуру
+void PointQueryEngine::query_range(const Point* points, size_t n, size_t* out) const {
+    static const TestFunc test = select_test();
+    constexpr size_t TILE = 32;
+
+    struct Item {
+        double x, y;
+        size_t index;
+        size_t cell;
+    };
+
+    size_t tiles_per_row = (grid_size + TILE - 1) / TILE;
+    auto tile_of = [&](size_t cell) {
+        return (cell / grid_size / TILE) * tiles_per_row + (cell % grid_size) / TILE;
+    };
+
+    std::vector<size_t> cells(n);
+    std::vector<size_t> tile_offsets(tiles_per_row * tiles_per_row + 1, 0);
+    for (size_t i = 0; i < n; ++i) {
+        cells[i] = cell_of(points[i].x, points[i].y);
+        out[i] = NOT_FOUND;
+        if (cells[i] != NOT_FOUND) ++tile_offsets[tile_of(cells[i]) + 1];
+    }
+    for (size_t t = 0; t + 1 < tile_offsets.size(); ++t) tile_offsets[t + 1] += tile_offsets[t];
+
+    std::vector<Item> by_tile(tile_offsets.back());
+    {
+        std::vector<size_t> fill(tile_offsets.begin(), tile_offsets.end() - 1);
+        for (size_t i = 0; i < n; ++i) {
+            if (cells[i] == NOT_FOUND) continue;
+            by_tile[fill[tile_of(cells[i])]++] = {points[i].x, points[i].y, i, cells[i]};
+        }
+    }
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<Item> by_cell;
+    std::vector<size_t> offsets(TILE * TILE + 1);
+    for (size_t t = 0; t + 1 < tile_offsets.size(); ++t) {
+        size_t begin = tile_offsets[t];
+        size_t end = tile_offsets[t + 1];
+        if (begin == end) continue;
+
+        // Раскладка точек блока по его ячейкам
+        size_t tile_x = (t % tiles_per_row) * TILE;
+        size_t tile_y = (t / tiles_per_row) * TILE;
+        auto local_of = [&](size_t cell) {
+            return (cell / grid_size - tile_y) * TILE + (cell % grid_size - tile_x);
+        };
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (size_t i = begin; i < end; ++i) ++offsets[local_of(by_tile[i].cell) + 1];
+        for (size_t c = 0; c < TILE * TILE; ++c) offsets[c + 1] += offsets[c];
+        by_cell.resize(end - begin);
+        {
+            std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = begin; i < end; ++i) by_cell[fill[local_of(by_tile[i].cell)]++] = by_tile[i];
+        }
+
+        for (size_t local = 0; local < TILE * TILE; ++local) {
+            if (offsets[local] == offsets[local + 1]) continue;
+            size_t c = by_cell[offsets[local]].cell;
+            const CellEntry* candidates = cell_entries.data() + cell_offsets[c];
+            size_t candidates_num = cell_offsets[c + 1] - cell_offsets[c];
+
+            for (size_t first = offsets[local]; first < offsets[local + 1]; first += LANES) {
+                size_t lanes = std::min(LANES, offsets[local + 1] - first);
+                // NaN в пустых дорожках не проходит ни одного сравнения
+                double gx[LANES] = {nan, nan, nan, nan};
+                double gy[LANES] = {nan, nan, nan, nan};
+                for (size_t lane = 0; lane < lanes; ++lane) {
+                    gx[lane] = by_cell[first + lane].x;
+                    gy[lane] = by_cell[first + lane].y;
+                }
+
+                // Кандидаты ячейки и большие фигуры сливаются по возрастанию индекса фигуры
+                unsigned pending = (1u << lanes) - 1;
+                size_t k = 0;
+                size_t j = 0;
+                while (pending != 0 && (k < candidates_num || j < large_entries.size())) {
+                    bool from_cell = j == large_entries.size() ||
+                                     (k < candidates_num && candidates[k].figure < large_entries[j].figure);
+                    const CellEntry& entry = from_cell ? candidates[k++] : large_entries[j++];
+
+                    // Отсев по прямоугольнику из самой ячейки, к ребрам идем только при попадании
+                    unsigned in_box = 0;
+                    for (size_t lane = 0; lane < lanes; ++lane) {
+                        in_box |= unsigned(entry.box.contains({gx[lane], gy[lane]})) << lane;
+                    }
+                    if ((in_box & pending) == 0) continue;
+
+                    unsigned hit = test(edges.data() + entry.edges_begin, entry.edges_num, entry.box, gx, gy) & pending;
+                    for (unsigned bits = hit; bits != 0; bits &= bits - 1) {
+                        out[by_cell[first + __builtin_ctz(bits)].index] = entry.figure;
+                    }
+                    pending &= ~hit;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,261 @@
+#include "../include/rtree.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Удвоенный центр прямоугольника (для сортировки деление не нужно)
+double center_x(const BoundingBox& box) { return box.min.x + box.max.x; }
+double center_y(const BoundingBox& box) { return box.min.y + box.max.y; }
+
+} // namespace
+
+// Прямоугольник узла
+BoundingBox RTree::Node::box() const {
+    BoundingBox result = entries[0].box;
+    for (size_t i = 1; i < entries.size(); ++i) {
+        result = result.merge(entries[i].box);
+    }
+    return result;
+}
+
+// Конструкторы
+RTree::RTree() : root(std::make_unique<Node>()), size(0) {}
+
+RTree::RTree(const FigureArray& arr) : RTree() {
+    build(arr);
+}
+
+// Перестроение упаковкой STR
+void RTree::build(const FigureArray& arr) {
+    size = arr.get_size();
+    if (size == 0) {
+        root = std::make_unique<Node>();
+        return;
+    }
+
+    std::vector<Entry> level(size);
+    for (size_t i = 0; i < size; ++i) {
+        const Figure& f = arr.get(i);
+        level[i].box = f.bounding_box();
+        level[i].figure = &f;
+    }
+
+    level = pack(std::move(level), true);
+    while (level.size() > 1) {
+        level = pack(std::move(level), false);
+    }
+    root = std::move(level[0].child);
+}
+
+// Упаковка элементов уровня в узлы: полосы по x, внутри полос - группы по y
+std::vector<RTree::Entry> RTree::pack(std::vector<Entry> entries, bool leaf) {
+    size_t n = entries.size();
+    size_t nodes = (n + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    size_t slices = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nodes))));
+    size_t per_slice = slices * NODE_CAPACITY;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return center_x(a.box) < center_x(b.box);
+    });
+
+    std::vector<Entry> parents;
+    parents.reserve(nodes);
+    for (size_t begin = 0; begin < n; begin += per_slice) {
+        size_t end = std::min(n, begin + per_slice);
+        std::sort(entries.begin() + begin, entries.begin() + end, [](const Entry& a, const Entry& b) {
+            return center_y(a.box) < center_y(b.box);
+        });
+
+        for (size_t first = begin; first < end; first += NODE_CAPACITY) {
+            size_t last = std::min(end, first + NODE_CAPACITY);
+            auto node = std::make_unique<Node>();
+            node->leaf = leaf;
+            node->entries.reserve(last - first);
+            for (size_t i = first; i < last; ++i) {
+                node->entries.push_back(std::move(entries[i]));
+            }
+
+            Entry parent;
+            parent.box = node->box();
+            parent.child = std::move(node);
+            parents.push_back(std::move(parent));
+        }
+    }
+    return parents;
+}
+
+// Добавление фигуры
+void RTree::insert(const Figure& f) {
+    Entry entry;
+    entry.box = f.bounding_box();
+    entry.figure = &f;
+
+    std::unique_ptr<Node> sibling = insert(*root, std::move(entry));
+    if (sibling) {
+        // Корень разделился - дерево растет на уровень вверх
+        auto new_root = std::make_unique<Node>();
+        new_root->leaf = false;
+        Entry left;
+        left.box = root->box();
+        left.child = std::move(root);
+        Entry right;
+        right.box = sibling->box();
+        right.child = std::move(sibling);
+        new_root->entries.push_back(std::move(left));
+        new_root->entries.push_back(std::move(right));
+        root = std::move(new_root);
+    }
+    ++size;
+}
+
+// Вставка в поддерево: спускаемся в потомка, прямоугольник которого увеличится меньше всего
+std::unique_ptr<RTree::Node> RTree::insert(Node& node, Entry entry) {
+    if (node.leaf) {
+        node.entries.push_back(std::move(entry));
+    } else {
+        size_t best = 0;
+        double best_growth = 0.0;
+        double best_area = 0.0;
+        for (size_t i = 0; i < node.entries.size(); ++i) {
+            double area = node.entries[i].box.area();
+            double growth = node.entries[i].box.merge(entry.box).area() - area;
+            if (i == 0 || growth < best_growth || (growth == best_growth && area < best_area)) {
+                best = i;
+                best_growth = growth;
+                best_area = area;
+            }
+        }
+
+        Entry& target = node.entries[best];
+        target.box = target.box.merge(entry.box);
+        std::unique_ptr<Node> sibling = insert(*target.child, std::move(entry));
+        if (sibling) {
+            target.box = target.child->box();
+            Entry added;
+            added.box = sibling->box();
+            added.child = std::move(sibling);
+            node.entries.push_back(std::move(added));
+        }
+    }
+
+    if (node.entries.size() > NODE_CAPACITY) {
+        return split(node);
+    }
+    return nullptr;
+}
+
+// Деление узла: элементы сортируются по центрам вдоль оси наибольшего разброса,
+// вторая половина уходит в новый узел
+std::unique_ptr<RTree::Node> RTree::split(Node& node) {
+    BoundingBox centers{{center_x(node.entries[0].box), center_y(node.entries[0].box)},
+                        {center_x(node.entries[0].box), center_y(node.entries[0].box)}};
+    for (const auto& entry : node.entries) {
+        Point c{center_x(entry.box), center_y(entry.box)};
+        centers = centers.merge({c, c});
+    }
+    bool by_x = centers.max.x - centers.min.x >= centers.max.y - centers.min.y;
+    std::sort(node.entries.begin(), node.entries.end(), [by_x](const Entry& a, const Entry& b) {
+        return by_x ? center_x(a.box) < center_x(b.box) : center_y(a.box) < center_y(b.box);
+    });
+
+    auto sibling = std::make_unique<Node>();
+    sibling->leaf = node.leaf;
+    size_t half = node.entries.size() / 2;
+    for (size_t i = half; i < node.entries.size(); ++i) {
+        sibling->entries.push_back(std::move(node.entries[i]));
+    }
+    node.entries.resize(half);
+    return sibling;
+}
+
+// Удаление фигуры
+bool RTree::remove(const Figure& f) {
+    if (size == 0 || !remove(*root, &f, f.bounding_box())) return false;
+    --size;
+
+    // Корень с единственным потомком заменяется потомком
+    while (!root->leaf && root->entries.size() == 1) {
+        std::unique_ptr<Node> child = std::move(root->entries[0].child);
+        root = std::move(child);
+    }
+    if (!root->leaf && root->entries.empty()) {
+        root = std::make_unique<Node>();
+    }
+    return true;
+}
+
+// Удаление из поддерева: ищем только в потомках, прямоугольник которых содержит прямоугольник фигуры
+bool RTree::remove(Node& node, const Figure* f, const BoundingBox& box) {
+    if (node.leaf) {
+        for (size_t i = 0; i < node.entries.size(); ++i) {
+            if (node.entries[i].figure == f) {
+                node.entries.erase(node.entries.begin() + i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    for (size_t i = 0; i < node.entries.size(); ++i) {
+        Entry& entry = node.entries[i];
+        if (!entry.box.overlaps(box) || !remove(*entry.child, f, box)) continue;
+
+        // Опустевший узел удаляется, иначе его прямоугольник сжимается
+        if (entry.child->entries.empty()) {
+            node.entries.erase(node.entries.begin() + i);
+        } else {
+            entry.box = entry.child->box();
+        }
+        return true;
+    }
+    return false;
+}
+
+// Высота дерева
+size_t RTree::get_height() const {
+    if (size == 0) return 0;
+    size_t height = 1;
+    for (const Node* node = root.get(); !node->leaf; node = node->entries[0].child.get()) {
+        ++height;
+    }
+    return height;
+}
+
+// Фигуры, содержащие точку: точная проверка только для кандидатов из листьев
+std::vector<const Figure*> RTree::query_point(const Point& p) const {
+    std::vector<const Figure*> result;
+    std::vector<const Node*> stack{root.get()};
+    while (!stack.empty()) {
+        const Node* node = stack.back();
+        stack.pop_back();
+        for (const auto& entry : node->entries) {
+            if (!entry.box.contains(p)) continue;
+            if (node->leaf) {
+                if (entry.figure->contains(p)) result.push_back(entry.figure);
+            } else {
+                stack.push_back(entry.child.get());
+            }
+        }
+    }
+    return result;
+}
+
+// Фигуры, пересекающие прямоугольник
+std::vector<const Figure*> RTree::query_rect(const BoundingBox& rect) const {
+    std::vector<const Figure*> result;
+    std::vector<const Node*> stack{root.get()};
+    while (!stack.empty()) {
+        const Node* node = stack.back();
+        stack.pop_back();
+        for (const auto& entry : node->entries) {
+            if (!entry.box.overlaps(rect)) continue;
+            if (node->leaf) {
+                if (entry.figure->intersects(rect)) result.push_back(entry.figure);
+            } else {
+                stack.push_back(entry.child.get());
+            }
+        }
+    }
+    return result;
+}
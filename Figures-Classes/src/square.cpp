@@ -4,11 +4,16 @@
 // Конструкторы
 Square::Square() : Figure(SQUARE_VERTICES) {}
 
-Square::Square(Point* verts) : Figure(SQUARE_VERTICES, verts) {
+Square::Square(Point* verts) : Square(verts, nullptr) {}
+
+Square::Square(FigurePool& pool) : Figure(SQUARE_VERTICES, &pool) {}
+
+Square::Square(Point* verts, FigurePool& pool) : Square(verts, &pool) {}
+
+Square::Square(Point* verts, FigurePool* pool) : Figure(SQUARE_VERTICES, verts, pool) {
     if (!isSquare()) {
         throw std::invalid_argument("Points do not form a square");
     }
-    this->sortVertices();
 }
 
 // Конструктор копирования
@@ -39,11 +44,11 @@ void Square::read(std::istream& in) {
     for (size_t i = 0; i < SQUARE_VERTICES; ++i) {
         in >> this->vertices[i];
     }
+    this->sortVertices();
 
     if (!isConvex() || !isSquare()) {
         throw std::invalid_argument("Points do not form a convex square");
     }
-    this->sortVertices();
 }
 
 void Square::write(std::ostream& out) const {
@@ -68,6 +73,11 @@ bool Square::equals(const Figure& other) const {
     return Figure::equals(other);
 }
 
+// Допустимость преобразования
+bool Square::can_transform(const AffineTransform& m) const {
+    return Figure::can_transform(m) && m.is_similarity();
+}
+
 // Проверка квадрата на квадратность
 bool Square::isSquare() const {
     if (vertices_num != 4) return false;
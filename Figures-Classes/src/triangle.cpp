@@ -3,14 +3,19 @@
 // Конструкторы
 Triangle::Triangle() : Figure(TRIANGLE_VERTICES) {}
 
-Triangle::Triangle(Point* verts) : Figure(TRIANGLE_VERTICES, verts) {
+Triangle::Triangle(Point* verts) : Triangle(verts, nullptr) {}
+
+Triangle::Triangle(FigurePool& pool) : Figure(TRIANGLE_VERTICES, &pool) {}
+
+Triangle::Triangle(Point* verts, FigurePool& pool) : Triangle(verts, &pool) {}
+
+Triangle::Triangle(Point* verts, FigurePool* pool) : Figure(TRIANGLE_VERTICES, verts, pool) {
     if (!isConvex()) {
         throw std::invalid_argument("Triangle is not convex");
     }
     if (static_cast<double>(*this) == 0.0) {
         throw std::invalid_argument("Degenerate triangle");
     }
-    this->sortVertices();
 }
 
 // Конструктор копирования
@@ -41,6 +46,7 @@ void Triangle::read(std::istream& in) {
     for (size_t i = 0; i < TRIANGLE_VERTICES; ++i) {
         in >> this->vertices[i];
     }
+    this->sortVertices();
 
     if (!isConvex()) {
         throw std::invalid_argument("Triangle is not convex");
@@ -48,7 +54,6 @@ void Triangle::read(std::istream& in) {
     if (static_cast<double>(*this) == 0.0) {
         throw std::invalid_argument("Degenerate triangle");
     }
-    this->sortVertices();
 }
 
 void Triangle::write(std::ostream& out) const {
@@ -0,0 +1,118 @@
+#include "../include/vertex_order.hpp"
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Вершины, для которых вместо сетей сортировки используется std::sort
+constexpr size_t SMALL = 16;
+
+// Упорядочивание пары (i, j) по ключу без ветвлений
+inline void exchange(double* key, Point* p, size_t i, size_t j) {
+    bool swap = key[j] < key[i];
+    double ki = key[i];
+    double kj = key[j];
+    Point pi = p[i];
+    Point pj = p[j];
+    key[i] = swap ? kj : ki;
+    key[j] = swap ? ki : kj;
+    p[i] = swap ? pj : pi;
+    p[j] = swap ? pi : pj;
+}
+
+// Сети сортировки: пары сравниваемых позиций
+constexpr size_t NETWORK3[][2] = {{0, 2}, {0, 1}, {1, 2}};
+constexpr size_t NETWORK4[][2] = {{0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}};
+constexpr size_t NETWORK5[][2] = {{0, 1}, {3, 4}, {2, 4}, {2, 3}, {0, 3}, {0, 2}, {1, 4}, {1, 3}, {1, 2}};
+constexpr size_t NETWORK8[][2] = {{0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1}, {2, 3},
+                                  {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}};
+
+template <size_t N>
+inline void apply(const size_t (&network)[N][2], double* key, Point* p) {
+    for (const auto& pair : network) exchange(key, p, pair[0], pair[1]);
+}
+
+// Сортировка вершин по готовым ключам
+void sort_by_keys(Point* verts, double* key, size_t n) {
+    switch (n) {
+        case 3: apply(NETWORK3, key, verts); return;
+        case 4: apply(NETWORK4, key, verts); return;
+        case 5: apply(NETWORK5, key, verts); return;
+        case 8: apply(NETWORK8, key, verts); return;
+        default: break;
+    }
+
+    if (n <= SMALL) {
+        // Вставками
+        for (size_t i = 1; i < n; ++i) {
+            double k = key[i];
+            Point p = verts[i];
+            size_t j = i;
+            for (; j > 0 && k < key[j - 1]; --j) {
+                key[j] = key[j - 1];
+                verts[j] = verts[j - 1];
+            }
+            key[j] = k;
+            verts[j] = p;
+        }
+        return;
+    }
+
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return key[a] < key[b]; });
+    std::vector<Point> sorted(n);
+    for (size_t i = 0; i < n; ++i) sorted[i] = verts[order[i]];
+    std::copy(sorted.begin(), sorted.end(), verts);
+}
+
+// Упорядочивание с буфером ключей на стеке для небольших фигур
+void order_with_center(Point* verts, size_t n, const Point& c) {
+    double small[SMALL];
+    std::vector<double> large;
+    double* key = small;
+    if (n > SMALL) {
+        large.resize(n);
+        key = large.data();
+    }
+    for (size_t i = 0; i < n; ++i) {
+        key[i] = pseudo_angle(verts[i].x - c.x, verts[i].y - c.y);
+    }
+    sort_by_keys(verts, key, n);
+}
+
+} // namespace
+
+// Упорядочивание вершин вокруг точки
+void order_vertices(Point* verts, size_t n, const Point& c) {
+    if (n < 2) return;
+    order_with_center(verts, n, c);
+}
+
+// Пакетное упорядочивание
+void order_vertices_batch(Point* verts, size_t n, size_t count, size_t threads) {
+    if (n < 2) return;
+
+    auto run = [=](size_t begin, size_t end) {
+        for (size_t f = begin; f < end; ++f) {
+            Point* figure = verts + f * n;
+            Point c;
+            for (size_t i = 0; i < n; ++i) c = c + figure[i];
+            order_with_center(figure, n, c / n);
+        }
+    };
+
+    constexpr size_t MIN_CHUNK = 4096;
+    threads = std::max<size_t>(1, std::min(threads, (count + MIN_CHUNK - 1) / MIN_CHUNK));
+    size_t chunk = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        size_t begin = std::min(count, t * chunk);
+        size_t end = std::min(count, begin + chunk);
+        workers.emplace_back(run, begin, end);
+    }
+    run(0, std::min(count, chunk));
+    for (auto& worker : workers) worker.join();
+}
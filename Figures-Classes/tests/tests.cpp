@@ -3,6 +3,24 @@
 #include "../include/square.hpp"
 #include "../include/octagon.hpp"
 #include "../include/figure_array.hpp"
+#include "../include/figure_columns.hpp"
+#include "../include/figure_loader.hpp"
+#include "../include/rtree.hpp"
+#include "../include/point_query.hpp"
+#include "../include/overlap.hpp"
+#include "../include/figure_variant.hpp"
+#include "../include/figure_pool.hpp"
+#include "../include/vertex_order.hpp"
+#include "../include/convex_hull.hpp"
+#include "../include/convex_polygon.hpp"
+#include "../include/figure_snapshot.hpp"
+#include "../include/affine.hpp"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <random>
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 
 TEST(TriangleTest, Area) {
@@ -289,6 +307,995 @@ TEST(FigureArrayTest, LargeArray) {
     EXPECT_NEAR(arr.total_area(), 50.0, 1e-6);
 }
 
+TEST(FigureColumnsTest, MatchesFigures) {
+    // Площади и центры совпадают с вычисленными самими фигурами, в том числе на хвосте меньше 4 фигур
+    std::vector<Figure*> figures;
+    for (int i = 0; i < 11; ++i) {
+        double d = i * 0.37;
+        Point tpoints[3] = {{d, 0}, {d + 2, 1}, {d, 3 + d}};
+        figures.push_back(new Triangle(tpoints));
+        Point spoints[4] = {{d, d}, {d + 2, d}, {d + 2, d + 2}, {d, d + 2}};
+        figures.push_back(new Square(spoints));
+    }
+    Point opoints[8] = {{0, 1}, {1, 2}, {2, 2}, {3, 1}, {3, 0}, {2, -1}, {1, -1}, {0, 0}};
+    figures.push_back(new Octagon(opoints));
+
+    FigureColumns columns;
+    double total = 0.0;
+    for (auto f : figures) {
+        columns.add(*f);
+        total += static_cast<double>(*f);
+    }
+
+    ASSERT_EQ(columns.get_size(), figures.size());
+    std::vector<double> areas = columns.areas();
+    std::vector<Point> centers = columns.centers();
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_DOUBLE_EQ(areas[i], static_cast<double>(*figures[i]));
+        EXPECT_DOUBLE_EQ(columns.area(i), static_cast<double>(*figures[i]));
+        EXPECT_DOUBLE_EQ(centers[i].x, figures[i]->center().x);
+        EXPECT_DOUBLE_EQ(centers[i].y, figures[i]->center().y);
+        EXPECT_EQ(columns.center(i), figures[i]->center());
+    }
+    EXPECT_NEAR(columns.total_area(), total, 1e-9);
+
+    for (auto f : figures) delete f;
+}
+
+TEST(FigureColumnsTest, Pop) {
+    FigureColumns columns;
+    Point tpoints[3] = {{0, 0}, {1, 0}, {0, 1}};
+    Triangle t(tpoints);
+    Point spoints[4] = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+    Square s(spoints);
+    columns.add(t);
+    columns.add(s);
+    columns.add(t);
+    columns.add(s);
+
+    columns.pop(0);
+    ASSERT_EQ(columns.get_size(), 3);
+    EXPECT_NEAR(columns.area(0), 4.0, 1e-9);
+    EXPECT_NEAR(columns.area(1), 0.5, 1e-9);
+    EXPECT_NEAR(columns.area(2), 4.0, 1e-9);
+    EXPECT_NEAR(columns.total_area(), 8.5, 1e-9);
+    EXPECT_THROW(columns.pop(3), std::out_of_range);
+}
+
+TEST(FigureArrayTest, ColumnsStorage) {
+    FigureArray arr(0, FigureArray::Storage::Columns);
+    Point tpoints[3] = {{0, 0}, {1, 0}, {0, 1}};
+    arr.add(*new Triangle(tpoints));
+    Point spoints[4] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    arr.add(*new Square(spoints));
+    EXPECT_NEAR(arr.total_area(), 1.5, 1e-6);
+
+    arr.pop(0);
+    EXPECT_NEAR(arr.total_area(), 1.0, 1e-6);
+
+    FigureArray copy(arr);
+    EXPECT_EQ(copy.get_storage(), FigureArray::Storage::Columns);
+    EXPECT_NEAR(copy.total_area(), 1.0, 1e-6);
+
+    // Переключение режимов не меняет результат
+    arr.add(*new Triangle(tpoints));
+    arr.set_storage(FigureArray::Storage::Pointers);
+    EXPECT_NEAR(arr.total_area(), 1.5, 1e-6);
+    arr.set_storage(FigureArray::Storage::Columns);
+    EXPECT_NEAR(arr.total_area(), 1.5, 1e-6);
+
+    std::stringstream out;
+    std::streambuf* old = std::cout.rdbuf(out.rdbuf());
+    arr.array_square();
+    arr.array_center();
+    std::cout.rdbuf(old);
+    EXPECT_EQ(out.str(), "1\n0.5\n(0.5, 0.5)\n(0.333333, 0.333333)\n");
+
+    // Фигура без вершин не попадает ни в столбцы, ни в массив
+    Triangle* empty = new Triangle(tpoints);
+    Triangle taken(std::move(*empty));
+    EXPECT_THROW(arr.add(*empty), std::invalid_argument);
+    delete empty;
+    EXPECT_EQ(arr.get_size(), 2);
+    EXPECT_NEAR(arr.total_area(), 1.5, 1e-6);
+    EXPECT_NEAR(arr.compute_total_area(), 1.5, 1e-6);
+    arr.pop(1);
+    EXPECT_NEAR(arr.compute_total_area(), 1.0, 1e-6);
+}
+
+TEST(FigureTest, CacheInvalidatedOnRead) {
+    Point points[4] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    Square s(points);
+    EXPECT_NEAR(static_cast<double>(s), 1.0, 1e-9);
+    EXPECT_EQ(s.center(), (Point{0.5, 0.5}));
+
+    std::istringstream in("0 0 2 0 2 2 0 2");
+    in >> s;
+    EXPECT_NEAR(static_cast<double>(s), 4.0, 1e-9);
+    EXPECT_EQ(s.center(), (Point{1.0, 1.0}));
+    BoundingBox box = s.bounding_box();
+    EXPECT_EQ(box.min, (Point{0, 0}));
+    EXPECT_EQ(box.max, (Point{2, 2}));
+}
+
+TEST(FigureTest, ConcurrentConstReads) {
+    Point points[8] = {{0, 1}, {1, 2}, {2, 2}, {3, 1}, {3, 0}, {2, -1}, {1, -1}, {0, 0}};
+    const Octagon octagon(points);
+    std::vector<std::thread> readers;
+    std::vector<int> mismatches(4, 0);
+    for (size_t t = 0; t < mismatches.size(); ++t) {
+        readers.emplace_back([&, t] {
+            for (int i = 0; i < 10000; ++i) {
+                mismatches[t] += static_cast<double>(octagon) != 7.0 || octagon.center() != (Point{1.5, 0.5}) ||
+                                 octagon.bounding_box().max != (Point{3, 2});
+            }
+        });
+    }
+    for (auto& reader : readers) reader.join();
+    EXPECT_EQ(mismatches, std::vector<int>(4, 0));
+}
+
+TEST(FigureTest, CacheFollowsAssignment) {
+    Point small[3] = {{0, 0}, {1, 0}, {0, 1}};
+    Point large[3] = {{0, 0}, {4, 0}, {0, 4}};
+    Triangle a(small);
+    Triangle b(large);
+    EXPECT_NEAR(static_cast<double>(a), 0.5, 1e-9);
+    EXPECT_NEAR(static_cast<double>(b), 8.0, 1e-9);
+
+    a = b;
+    EXPECT_NEAR(static_cast<double>(a), 8.0, 1e-9);
+    EXPECT_EQ(a.bounding_box().max, (Point{4, 4}));
+
+    Triangle c(small);
+    a = std::move(c);
+    EXPECT_NEAR(static_cast<double>(a), 0.5, 1e-9);
+}
+
+TEST(FigureArrayTest, RunningTotalArea) {
+    FigureArray arr;
+    Point big[4] = {{0, 0}, {1e10, 0}, {1e10, 1e10}, {0, 1e10}};
+    Point tpoints[3] = {{0, 0}, {1, 0}, {0, 1}};
+    arr.add(*new Square(big));
+    for (int i = 0; i < 10; ++i) {
+        arr.add(*new Triangle(tpoints));
+    }
+    // Малые площади не теряются на фоне большой
+    arr.pop(0);
+    EXPECT_DOUBLE_EQ(arr.total_area(), 5.0);
+    EXPECT_DOUBLE_EQ(arr.total_area(), arr.compute_total_area());
+
+    while (arr.get_size() > 0) arr.pop(0);
+    EXPECT_EQ(arr.total_area(), 0.0);
+}
+
+TEST(FigureArrayTest, ParallelTotalAreaIsDeterministic) {
+    FigureArray arr;
+    for (int i = 0; i < 5000; ++i) {
+        double s = 1e-3 + (i * 7919 % 1000) * 0.731;
+        Point points[3] = {{0, 0}, {s, 0}, {0, s}};
+        arr.add(*new Triangle(points));
+    }
+
+    double single = arr.parallel_total_area(1);
+    EXPECT_NEAR(single, arr.compute_total_area(), 1e-6 * single);
+    for (size_t threads : {2, 3, 4, 7, 16}) {
+        EXPECT_EQ(arr.parallel_total_area(threads), single);
+    }
+
+    FigureArray empty;
+    EXPECT_EQ(empty.parallel_total_area(4), 0.0);
+}
+
+TEST(FigureArrayTest, ParallelPrintMatchesSerial) {
+    FigureArray arr;
+    for (int i = 0; i < 3000; ++i) {
+        Point points[3] = {{0, 0}, {1.0 + i, 0}, {0, 2.0}};
+        arr.add(*new Triangle(points));
+    }
+
+    auto capture = [](auto print) {
+        std::stringstream out;
+        std::streambuf* old = std::cout.rdbuf(out.rdbuf());
+        print();
+        std::cout.rdbuf(old);
+        return out.str();
+    };
+    EXPECT_EQ(capture([&] { arr.parallel_array_square(4); }), capture([&] { arr.array_square(); }));
+    EXPECT_EQ(capture([&] { arr.parallel_array_center(3); }), capture([&] { arr.array_center(); }));
+}
+
+TEST(FigureLoaderTest, ParseMatchesRead) {
+    std::string text =
+        "triangle 0 0 1 0 0 1\n"
+        "unknown 5\n"
+        "square 0 0 +2 0 2 2 0 2\n"
+        "octagon 0 1 1 2 2 2 3 1 3 0 2 -1 1 -1 0 0\n";
+
+    FigureArray expected;
+    std::istringstream in(text);
+    in >> expected;
+
+    FigureArray arr;
+    EXPECT_EQ(parse_figures(arr, text), 3);
+    ASSERT_EQ(arr.get_size(), expected.get_size());
+    EXPECT_DOUBLE_EQ(arr.total_area(), expected.total_area());
+
+    std::stringstream out1, out2;
+    out1 << arr;
+    out2 << expected;
+    EXPECT_EQ(out1.str(), out2.str());
+
+    // Вывод write с круглыми скобками и запятыми читается обратно
+    FigureArray again;
+    EXPECT_EQ(parse_figures(again, out1.str()), 3);
+    EXPECT_DOUBLE_EQ(again.total_area(), arr.total_area());
+}
+
+TEST(FigureLoaderTest, ThreadsGiveSameOrder) {
+    std::string text;
+    for (int i = 0; i < 3000; ++i) {
+        int s = 1 + i % 17;
+        text += "triangle 0 0 " + std::to_string(s) + " 0 0 " + std::to_string(i + 1) + "\n";
+        text += "square 0 0 " + std::to_string(s) + " 0 " + std::to_string(s) + " " + std::to_string(s) + " 0 " + std::to_string(s) + "\n";
+    }
+
+    FigureArray single;
+    parse_figures(single, text, 1);
+    std::stringstream expected;
+    expected << single;
+
+    for (size_t threads : {2, 3, 8}) {
+        FigureArray arr;
+        EXPECT_EQ(parse_figures(arr, text, threads), 6000);
+        std::stringstream out;
+        out << arr;
+        EXPECT_EQ(out.str(), expected.str());
+    }
+}
+
+TEST(FigureLoaderTest, InvalidRecordAddsNothing) {
+    FigureArray arr;
+    Point points[3] = {{0, 0}, {1, 0}, {0, 1}};
+    arr.add(*new Triangle(points));
+
+    EXPECT_THROW(parse_figures(arr, "triangle 0 0 1 0 0 1 square 0 0 2 0 1 1 0 2"), std::invalid_argument);
+    EXPECT_THROW(parse_figures(arr, "triangle 0 0 1 x 0 1"), std::invalid_argument);
+    EXPECT_THROW(parse_figures(arr, "triangle 0 0 1 0"), std::invalid_argument);
+
+    // Неконечные координаты: площадь массива не должна стать NaN
+    for (const char* text : {"triangle 0 0 nan 0 0 1", "triangle 0 0 inf 0 0 1", "triangle 0 0 1 0 0 -infinity",
+                             "polygon 3 0 0 1 0 NAN 1"}) {
+        EXPECT_THROW(parse_figures(arr, text), std::invalid_argument);
+    }
+    EXPECT_EQ(arr.get_size(), 1);
+    EXPECT_EQ(arr.total_area(), 0.5);
+
+    std::string path = "figure_loader_nan_test.txt";
+    {
+        std::ofstream out(path);
+        out << "triangle 0 0 nan 0 0 1\n";
+    }
+    EXPECT_THROW(load_figures(arr, path), std::invalid_argument);
+    EXPECT_EQ(arr.get_size(), 1);
+    std::remove(path.c_str());
+}
+
+TEST(FigureLoaderTest, LoadFile) {
+    std::string path = "figure_loader_test.txt";
+    {
+        std::ofstream out(path);
+        out << "triangle 0 0 4 0 0 4\nsquare 0 0 1 0 1 1 0 1\n";
+    }
+    FigureArray arr;
+    EXPECT_EQ(load_figures(arr, path, 2), 2);
+    EXPECT_NEAR(arr.total_area(), 9.0, 1e-9);
+    std::remove(path.c_str());
+
+    EXPECT_THROW(load_figures(arr, "no_such_file.txt"), std::runtime_error);
+}
+
+TEST(FigureTest, ContainsAndIntersects) {
+    Point points[3] = {{0, 0}, {4, 0}, {0, 4}};
+    Triangle t(points);
+    EXPECT_TRUE(t.contains({1, 1}));
+    EXPECT_TRUE(t.contains({2, 2}));  // на границе
+    EXPECT_FALSE(t.contains({3, 3}));
+    EXPECT_FALSE(t.contains({-1, 1}));
+
+    EXPECT_TRUE(t.intersects({{1, 1}, {5, 5}}));
+    EXPECT_TRUE(t.intersects({{-1, -1}, {10, 10}}));
+    // Прямоугольник внутри ограничивающего, но за гипотенузой
+    EXPECT_FALSE(t.intersects({{3, 3}, {4, 4}}));
+}
+
+namespace {
+
+// Случайные треугольники и квадраты в квадрате [0, 100]
+void fill_random(FigureArray& arr, size_t count, std::mt19937& rng) {
+    std::uniform_real_distribution<double> coord(0.0, 100.0);
+    std::uniform_int_distribution<int> side(1, 5);
+    for (size_t i = 0; i < count; ++i) {
+        double x = std::round(coord(rng));
+        double y = std::round(coord(rng));
+        double s = side(rng);
+        if (i % 2 == 0) {
+            Point points[3] = {{x, y}, {x + s, y + 1}, {x + 1, y + s + 1}};
+            arr.add(*new Triangle(points));
+        } else {
+            Point points[4] = {{x, y}, {x + s, y}, {x + s, y + s}, {x, y + s}};
+            arr.add(*new Square(points));
+        }
+    }
+}
+
+// Сравнение ответов дерева с полным перебором
+void check_queries(const FigureArray& arr, const RTree& tree, std::mt19937& rng) {
+    std::uniform_real_distribution<double> coord(-5.0, 105.0);
+    for (int q = 0; q < 200; ++q) {
+        Point p{coord(rng), coord(rng)};
+        std::vector<const Figure*> expected;
+        for (size_t i = 0; i < arr.get_size(); ++i) {
+            if (arr.get(i).contains(p)) expected.push_back(&arr.get(i));
+        }
+        std::vector<const Figure*> actual = tree.query_point(p);
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        EXPECT_EQ(actual, expected);
+
+        BoundingBox rect{p, {p.x + 7, p.y + 3}};
+        expected.clear();
+        for (size_t i = 0; i < arr.get_size(); ++i) {
+            if (arr.get(i).intersects(rect)) expected.push_back(&arr.get(i));
+        }
+        actual = tree.query_rect(rect);
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+} // namespace
+
+TEST(RTreeTest, BulkLoadMatchesLinearScan) {
+    std::mt19937 rng(1);
+    FigureArray arr;
+    fill_random(arr, 1000, rng);
+    RTree tree(arr);
+    EXPECT_EQ(tree.get_size(), 1000);
+    EXPECT_EQ(tree.get_height(), 3);
+    check_queries(arr, tree, rng);
+}
+
+TEST(RTreeTest, InsertAndRemoveMirrorArray) {
+    std::mt19937 rng(2);
+    FigureArray arr;
+    RTree tree;
+    EXPECT_EQ(tree.get_height(), 0);
+    EXPECT_TRUE(tree.query_point({1, 1}).empty());
+
+    FigureArray source;
+    fill_random(source, 600, rng);
+    for (size_t i = 0; i < source.get_size(); ++i) {
+        Figure* f = source.get(i).clone();
+        arr.add(*f);
+        tree.insert(*f);
+    }
+    check_queries(arr, tree, rng);
+
+    for (int i = 0; i < 400; ++i) {
+        size_t index = rng() % arr.get_size();
+        EXPECT_TRUE(tree.remove(arr.get(index)));
+        arr.pop(index);
+    }
+    EXPECT_EQ(tree.get_size(), arr.get_size());
+    EXPECT_FALSE(tree.remove(source.get(0)));
+    check_queries(arr, tree, rng);
+
+    while (arr.get_size() > 0) {
+        EXPECT_TRUE(tree.remove(arr.get(0)));
+        arr.pop(0);
+    }
+    EXPECT_EQ(tree.get_height(), 0);
+}
+
+TEST(PointQueryTest, MatchesFirstContainingFigure) {
+    std::mt19937 rng(3);
+    FigureArray arr;
+    fill_random(arr, 800, rng);
+    Point opoints[8] = {{0, 1}, {1, 2}, {2, 2}, {3, 1}, {3, 0}, {2, -1}, {1, -1}, {0, 0}};
+    arr.add(*new Octagon(opoints));
+    PointQueryEngine engine(arr);
+    EXPECT_EQ(engine.get_size(), arr.get_size());
+
+    // Случайные точки и точки на вершинах (граница принадлежит фигуре)
+    std::uniform_real_distribution<double> coord(-5.0, 105.0);
+    std::vector<Point> points;
+    for (int i = 0; i < 20000; ++i) points.push_back({coord(rng), coord(rng)});
+    for (size_t i = 0; i < arr.get_size(); i += 7) points.push_back(arr.get(i).get_vertices()[0]);
+
+    std::vector<size_t> expected(points.size(), PointQueryEngine::NOT_FOUND);
+    for (size_t p = 0; p < points.size(); ++p) {
+        for (size_t i = 0; i < arr.get_size(); ++i) {
+            if (arr.get(i).contains(points[p])) {
+                expected[p] = i;
+                break;
+            }
+        }
+    }
+
+    EXPECT_EQ(engine.query(points), expected);
+    EXPECT_EQ(engine.query(points, 3), expected);
+    for (size_t p = 0; p < points.size(); p += 97) {
+        EXPECT_EQ(engine.query(points[p]), expected[p]);
+    }
+}
+
+// Фигуры, накрывающие много ячеек, проверяются отдельно и не теряют порядок по индексу
+TEST(PointQueryTest, LargeFiguresOutsideGrid) {
+    std::mt19937 rng(5);
+    FigureArray arr;
+    fill_random(arr, 400, rng);
+    Point big[4] = {{10, 10}, {90, 10}, {90, 90}, {10, 90}};
+    arr.add(*new Square(big));
+    fill_random(arr, 400, rng);
+    Point wide[3] = {{-5, 40}, {105, 40}, {50, 60}};
+    arr.add(*new Triangle(wide));
+    PointQueryEngine engine(arr);
+
+    std::uniform_real_distribution<double> coord(-5.0, 105.0);
+    std::vector<Point> points;
+    for (int i = 0; i < 20000; ++i) points.push_back({coord(rng), coord(rng)});
+
+    std::vector<size_t> expected(points.size(), PointQueryEngine::NOT_FOUND);
+    for (size_t p = 0; p < points.size(); ++p) {
+        for (size_t i = 0; i < arr.get_size(); ++i) {
+            if (arr.get(i).contains(points[p])) {
+                expected[p] = i;
+                break;
+            }
+        }
+    }
+
+    EXPECT_EQ(engine.query(points), expected);
+    EXPECT_EQ(engine.query(points, 3), expected);
+    for (size_t p = 0; p < points.size(); p += 97) {
+        EXPECT_EQ(engine.query(points[p]), expected[p]);
+    }
+}
+
+TEST(PointQueryTest, EmptyArray) {
+    FigureArray arr;
+    PointQueryEngine engine(arr);
+    std::vector<Point> points = {{0, 0}, {1, 1}};
+    EXPECT_EQ(engine.query(points), std::vector<size_t>(2, PointQueryEngine::NOT_FOUND));
+    EXPECT_EQ(engine.query(Point{0, 0}), PointQueryEngine::NOT_FOUND);
+}
+
+TEST(OverlapTest, IntersectionArea) {
+    Point a[4] = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+    Point b[4] = {{1, 1}, {1, 3}, {3, 3}, {3, 1}};
+    Point c[4] = {{3, 1}, {5, 1}, {5, 3}, {3, 3}};
+    Point t[3] = {{0.5, 0.5}, {1.5, 0.5}, {0.5, 1.5}};
+    Square first(a);
+    Square second(b);
+    Square touching(c);
+    Triangle inner(t);
+
+    // Обход по часовой стрелке у второго квадрата не мешает отсечению
+    EXPECT_DOUBLE_EQ(intersection_area(first, second), 1.0);
+    EXPECT_DOUBLE_EQ(intersection_area(second, first), 1.0);
+    EXPECT_EQ(intersection(first, second).size(), 4);
+    EXPECT_DOUBLE_EQ(intersection_area(first, inner), 0.5);
+    EXPECT_DOUBLE_EQ(intersection_area(first, touching), 0.0);
+    EXPECT_TRUE(intersection(first, touching).empty());
+    EXPECT_DOUBLE_EQ(intersection_area(second, touching), 0.0);
+    EXPECT_DOUBLE_EQ(intersection_area(touching, first), 0.0);
+}
+
+TEST(OverlapTest, MatchesAllPairs) {
+    // Координаты кратны 1/4, чтобы стороны квадратов считались точно
+    std::mt19937_64 rng(11);
+    std::uniform_int_distribution<int> coord(0, 240);
+    std::uniform_int_distribution<int> size(2, 24);
+    FigureArray arr;
+    for (int i = 0; i < 600; ++i) {
+        double x = coord(rng) * 0.25;
+        double y = coord(rng) * 0.25;
+        double s = size(rng) * 0.25;
+        if (i % 3 == 0) {
+            Point points[3] = {{x, y}, {x + s, y + s / 3}, {x + s / 4, y + s}};
+            arr.add(*new Triangle(points));
+        } else if (i % 3 == 1) {
+            Point points[4] = {{x, y}, {x + s, y}, {x + s, y + s}, {x, y + s}};
+            arr.add(*new Square(points));
+        } else {
+            Point points[8] = {{x, y + s / 3}, {x + s / 3, y + s}, {x + 2 * s / 3, y + s}, {x + s, y + 2 * s / 3},
+                               {x + s, y + s / 3}, {x + 2 * s / 3, y}, {x + s / 3, y}, {x, y}};
+            arr.add(*new Octagon(points));
+        }
+    }
+
+    std::vector<FigureOverlap> expected;
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        for (size_t j = i + 1; j < arr.get_size(); ++j) {
+            double area = intersection_area(arr.get(i), arr.get(j));
+            if (area > 0) expected.push_back({i, j, area});
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    for (size_t threads : {1, 3}) {
+        std::vector<FigureOverlap> pairs = find_overlaps(arr, threads);
+        ASSERT_EQ(pairs.size(), expected.size());
+        for (size_t k = 0; k < pairs.size(); ++k) {
+            EXPECT_EQ(pairs[k].first, expected[k].first);
+            EXPECT_EQ(pairs[k].second, expected[k].second);
+            EXPECT_DOUBLE_EQ(pairs[k].area, expected[k].area);
+        }
+    }
+    EXPECT_TRUE(find_overlaps(FigureArray()).empty());
+}
+
+TEST(FigureValueTest, MatchesFigures) {
+    Point tpoints[3] = {{0.1, 0.2}, {3.7, 0.4}, {1.3, 2.9}};
+    Point spoints[4] = {{0, 0}, {3, 0}, {3, 3}, {0, 3}};
+    Point opoints[8] = {{0, 1}, {1, 2}, {2, 2}, {3, 1}, {3, 0}, {2, -1}, {1, -1}, {0, 0}};
+    FigureArray arr;
+    arr.add(*new Triangle(tpoints));
+    arr.add(*new Square(spoints));
+    arr.add(*new Octagon(opoints));
+
+    FigureValueArray values(arr);
+    ASSERT_EQ(values.get_size(), arr.get_size());
+    EXPECT_TRUE(std::holds_alternative<TriangleValue>(values.get(0)));
+    EXPECT_TRUE(std::holds_alternative<SquareValue>(values.get(1)));
+    EXPECT_TRUE(std::holds_alternative<OctagonValue>(values.get(2)));
+
+    std::vector<double> areas = values.areas();
+    std::vector<Point> centers = values.centers();
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        EXPECT_EQ(areas[i], static_cast<double>(arr.get(i)));
+        EXPECT_EQ(centers[i], arr.get(i).center());
+        EXPECT_EQ(bounding_box(values.get(i)).min, arr.get(i).bounding_box().min);
+        EXPECT_EQ(bounding_box(values.get(i)).max, arr.get(i).bounding_box().max);
+    }
+    EXPECT_DOUBLE_EQ(values.total_area(), arr.total_area());
+
+    // Обратное преобразование дает равные фигуры тех же типов
+    FigureArray back = values.to_array();
+    ASSERT_EQ(back.get_size(), arr.get_size());
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        EXPECT_EQ(back.get(i).type(), arr.get(i).type());
+        EXPECT_TRUE(back.get(i).equals(arr.get(i)));
+    }
+}
+
+TEST(FigureValueTest, CopyAndPop) {
+    Point spoints[4] = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+    Square square(spoints);
+    FigureValueArray values;
+    values.add(square);
+    values.add(to_value(square));
+
+    FigureValueArray copy = values;
+    copy.pop(0);
+    EXPECT_EQ(copy.get_size(), 1);
+    EXPECT_EQ(values.get_size(), 2);
+    EXPECT_DOUBLE_EQ(values.total_area(), 8.0);
+    EXPECT_THROW(copy.pop(1), std::out_of_range);
+    EXPECT_THROW(copy.get(1), std::out_of_range);
+    copy.clear();
+    EXPECT_EQ(copy.get_size(), 0);
+}
+
+TEST(FigurePoolTest, ReusesBlocks) {
+    FigurePool pool;
+    void* a = pool.allocate(48);
+    void* b = pool.allocate(40);
+    void* c = pool.allocate(100);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.get_used(), 3);
+    EXPECT_EQ(pool.get_pages(), 2);
+
+    // Блок того же размерного класса выдается повторно
+    pool.deallocate(a, 48);
+    EXPECT_EQ(pool.allocate(33), a);
+
+    // Большие блоки берутся из кучи
+    void* big = pool.allocate(FigurePool::MAX_BLOCK + 1);
+    EXPECT_EQ(pool.get_pages(), 2);
+    pool.deallocate(big, FigurePool::MAX_BLOCK + 1);
+    pool.deallocate(a, 33);
+    pool.deallocate(b, 40);
+    pool.deallocate(c, 100);
+    EXPECT_EQ(pool.get_used(), 0);
+}
+
+TEST(FigureArrayTest, PooledFigures) {
+    Point spoints[4] = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+    Point tpoints[3] = {{0, 0}, {4, 0}, {0, 3}};
+    Point bad[4] = {{0, 0}, {3, 0}, {3, 1}, {0, 1}};
+
+    FigureArray arr;
+    Square& square = arr.emplace<Square>(spoints);
+    arr.emplace<Triangle>(tpoints);
+    arr.add(*new Square(spoints));
+    EXPECT_EQ(arr.get_size(), 3);
+    EXPECT_DOUBLE_EQ(static_cast<double>(square), 4.0);
+    EXPECT_DOUBLE_EQ(arr.total_area(), 14.0);
+
+    // Фигура и ее вершины - два блока пула
+    size_t used = arr.get_pool().get_used();
+    EXPECT_EQ(used, 4);
+    EXPECT_THROW(arr.emplace<Square>(bad), std::invalid_argument);
+    EXPECT_EQ(arr.get_pool().get_used(), used);
+    arr.pop(0);
+    EXPECT_EQ(arr.get_pool().get_used(), used - 2);
+
+    std::istringstream in("octagon 0 1 1 2 2 2 3 1 3 0 2 -1 1 -1 0 0\n");
+    arr.read(in);
+    EXPECT_EQ(arr.get_pool().get_used(), used);
+
+    // Копия получает фигуры из кучи, при перемещении пул переходит вместе с фигурами
+    FigureArray copy(arr);
+    FigureArray moved(std::move(arr));
+    ASSERT_EQ(moved.get_size(), 3);
+    for (size_t i = 0; i < moved.get_size(); ++i) {
+        EXPECT_TRUE(moved.get(i).equals(copy.get(i)));
+    }
+    EXPECT_EQ(moved.get_pool().get_used(), used);
+    moved = FigureArray();
+    EXPECT_EQ(copy.get_size(), 3);
+}
+
+TEST(VertexOrderTest, MatchesAtan2Order) {
+    std::mt19937_64 rng(5);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (size_t n : {3, 4, 5, 6, 8, 12, 40}) {
+        for (int trial = 0; trial < 200; ++trial) {
+            // Вершины выпуклого многоугольника в случайном порядке
+            std::vector<double> angles(n);
+            for (auto& a : angles) a = 2 * M_PI * unit(rng);
+            std::vector<Point> verts(n);
+            Point c;
+            for (size_t i = 0; i < n; ++i) {
+                verts[i] = {10 + 5 * cos(angles[i]), -3 + 2 * sin(angles[i])};
+                c = c + verts[i];
+            }
+            c = c / n;
+
+            std::vector<Point> expected = verts;
+            std::sort(expected.begin(), expected.end(), [&](const Point& a, const Point& b) {
+                return atan2(a.y - c.y, a.x - c.x) < atan2(b.y - c.y, b.x - c.x);
+            });
+            order_vertices(verts.data(), n, c);
+            EXPECT_EQ(verts, expected);
+        }
+    }
+
+    // Направления по осям и диагоналям, включая -0 по y
+    std::vector<Point> axes = {{1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}, {-1, -0.0}};
+    for (size_t i = 0; i < axes.size(); ++i) {
+        for (size_t j = 0; j < axes.size(); ++j) {
+            bool angle_less = atan2(axes[i].y, axes[i].x) < atan2(axes[j].y, axes[j].x);
+            EXPECT_EQ(pseudo_angle(axes[i].x, axes[i].y) < pseudo_angle(axes[j].x, axes[j].y), angle_less);
+        }
+    }
+}
+
+TEST(VertexOrderTest, BatchMatchesSingle) {
+    std::mt19937_64 rng(6);
+    std::uniform_real_distribution<double> coord(-100.0, 100.0);
+    for (size_t n : {4, 8, 7}) {
+        size_t count = 10000;
+        std::vector<Point> verts(n * count);
+        for (auto& p : verts) p = {coord(rng), coord(rng)};
+
+        std::vector<Point> expected = verts;
+        for (size_t f = 0; f < count; ++f) {
+            Point c;
+            for (size_t i = 0; i < n; ++i) c = c + expected[f * n + i];
+            order_vertices(expected.data() + f * n, n, c / n);
+        }
+        std::vector<Point> batch = verts;
+        order_vertices_batch(batch.data(), n, count, 3);
+        EXPECT_EQ(batch, expected);
+    }
+}
+
+TEST(ConvexHullTest, GridAndDegenerateInputs) {
+    std::vector<Point> grid;
+    for (int x = 0; x <= 4; ++x) {
+        for (int y = 0; y <= 4; ++y) grid.push_back({double(x), double(y)});
+    }
+    std::vector<Point> expected = {{0, 0}, {4, 0}, {4, 4}, {0, 4}};
+    EXPECT_EQ(convex_hull(grid), expected);
+
+    std::vector<Point> line = {{2, 0}, {0, 0}, {1, 0}, {0, 0}};
+    EXPECT_EQ(convex_hull(line), (std::vector<Point>{{0, 0}, {2, 0}}));
+    EXPECT_TRUE(convex_hull({}).empty());
+
+    // Выпуклое положение не зависит от порядка вершин
+    Point octagon[8] = {{0, 1}, {3, 0}, {2, 2}, {1, -1}, {1, 2}, {0, 0}, {3, 1}, {2, -1}};
+    EXPECT_TRUE(in_convex_position(octagon, 8));
+    Point inner[4] = {{0, 0}, {4, 0}, {0, 4}, {1, 1}};
+    EXPECT_FALSE(in_convex_position(inner, 4));
+    Point on_side[4] = {{0, 0}, {4, 0}, {0, 4}, {2, 0}};
+    EXPECT_TRUE(in_convex_position(on_side, 4));
+    Octagon shuffled(octagon);
+    EXPECT_DOUBLE_EQ(static_cast<double>(shuffled), 7.0);
+}
+
+// Фигура с вершинами в заданном порядке, без упорядочивания и проверок
+struct RawFigure : Figure {
+    RawFigure(const Point* verts, size_t n) : Figure(n) {
+        std::copy(verts, verts + n, vertices);
+        update_cache();
+    }
+    std::string type() const override { return "raw"; }
+    Figure* clone() const override { return new RawFigure(vertices, vertices_num); }
+};
+
+TEST(ConvexHullTest, IsConvexChecksVertexOrder) {
+    // Вершины в выпуклом положении, но обход самопересекающийся
+    Point bowtie[4] = {{0, 0}, {2, 2}, {2, 0}, {0, 2}};
+    EXPECT_TRUE(in_convex_position(bowtie, 4));
+    EXPECT_FALSE(RawFigure(bowtie, 4).isConvex());
+    Point ordered[4] = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+    EXPECT_TRUE(RawFigure(ordered, 4).isConvex());
+
+    // Конструктор и чтение сами упорядочивают вершины
+    Square square(bowtie);
+    EXPECT_TRUE(square.isConvex());
+    EXPECT_DOUBLE_EQ(static_cast<double>(square), 4.0);
+    std::istringstream in("0 0 2 2 2 0 0 2");
+    Square read_square;
+    read_square.read(in);
+    EXPECT_TRUE(read_square.equals(square));
+}
+
+TEST(ConvexHullTest, ParallelMatchesSerial) {
+    std::mt19937_64 rng(17);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::vector<Point> points;
+    while (points.size() < 200000) {
+        Point p = {unit(rng), unit(rng)};
+        if (p.x * p.x + p.y * p.y <= 1) points.push_back(p);
+    }
+
+    std::vector<Point> hull = convex_hull(points);
+    EXPECT_EQ(parallel_convex_hull(points, 1), hull);
+    EXPECT_EQ(parallel_convex_hull(points, 3), hull);
+
+    // Все точки внутри оболочки, обход против часовой стрелки
+    size_t h = hull.size();
+    ASSERT_GE(h, 3);
+    for (size_t i = 0; i < points.size(); i += 101) {
+        for (size_t e = 0; e < h; ++e) {
+            const Point& a = hull[e];
+            const Point& b = hull[(e + 1) % h];
+            EXPECT_GE((b.x - a.x) * (points[i].y - a.y) - (b.y - a.y) * (points[i].x - a.x), 0);
+        }
+    }
+}
+
+TEST(ConvexPolygonTest, BuildsFromPointCloud) {
+    std::vector<Point> cloud = {{1, 1}, {0, 0}, {2, 2}, {2, 0}, {0.5, 1.5}, {0, 2}, {1, 0}};
+    ConvexPolygon polygon(cloud);
+    EXPECT_EQ(polygon.get_vertices_num(), 4);
+    EXPECT_DOUBLE_EQ(static_cast<double>(polygon), 4.0);
+    EXPECT_EQ(polygon.center(), (Point{1, 1}));
+
+    Point corners[4] = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+    EXPECT_TRUE(polygon.equals(Square(corners)));
+    EXPECT_THROW(ConvexPolygon({{0, 0}, {1, 1}, {2, 2}}), std::invalid_argument);
+
+    // Чтение массивом, загрузчиком и запись
+    FigureArray arr;
+    std::istringstream in("polygon 5 0 0 2 0 2 2 0 2 1 1 triangle 0 0 1 0 0 1");
+    arr.read(in);
+    ASSERT_EQ(arr.get_size(), 2);
+    EXPECT_EQ(arr.get(0).type(), "polygon");
+    EXPECT_TRUE(arr.get(0).equals(polygon));
+
+    FigureArray loaded;
+    EXPECT_EQ(parse_figures(loaded, "polygon 6 (0, 0) (1, 0) (2, 0) (2, 2) (0, 2) (1, 1)\nsquare 0 0 1 0 1 1 0 1"), 2);
+    EXPECT_TRUE(loaded.get(0).equals(polygon));
+    EXPECT_THROW(parse_figures(loaded, "polygon 99999999 0 0"), std::invalid_argument);
+
+    std::ostringstream out;
+    polygon.write(out);
+    EXPECT_EQ(out.str().substr(0, 2), "4 ");
+}
+
+TEST(ConvexPolygonTest, RejectsBadInput) {
+    // Пустой многоугольник - вырожденный треугольник, а не фигура без вершин
+    ConvexPolygon empty;
+    EXPECT_EQ(empty.get_vertices_num(), ConvexPolygon::MIN_VERTICES);
+    EXPECT_EQ(empty.center(), (Point{0, 0}));
+    EXPECT_EQ(empty.bounding_box().max, (Point{0, 0}));
+    EXPECT_DOUBLE_EQ(static_cast<double>(empty), 0.0);
+
+    for (const char* text : {"2 0 0 1 1", "0", "99999999999 0 0 1 0 0 1", "3 0 0 1 0 0", "4 0 0 1 0 x 1 0 1"}) {
+        ConvexPolygon p;
+        std::istringstream in(text);
+        EXPECT_THROW(p.read(in), std::invalid_argument) << text;
+    }
+    FigureArray loaded;
+    EXPECT_THROW(parse_figures(loaded, "polygon 2 0 0 1 1"), std::invalid_argument);
+}
+
+TEST(FigureSnapshotTest, RoundTrip) {
+    FigureArray arr;
+    parse_figures(arr,
+        "triangle 0 0 1 0 0 1\n"
+        "square 0 0 2 0 2 2 0 2\n"
+        "octagon 0 1 1 2 2 2 3 1 3 0 2 -1 1 -1 0 0\n"
+        "polygon 5 0 0 4 0 4 4 0 4 2 2\n");
+
+    std::string path = "figure_snapshot_test.bin";
+    save_snapshot(arr, path);
+
+    FigureArray loaded;
+    Point points[3] = {{5, 5}, {6, 5}, {5, 6}};
+    loaded.add(*new Triangle(points));
+    EXPECT_EQ(load_snapshot(loaded, path), 4);
+    ASSERT_EQ(loaded.get_size(), 5);
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        EXPECT_EQ(loaded.get(i + 1).type(), arr.get(i).type());
+        EXPECT_TRUE(loaded.get(i + 1).equals(arr.get(i)));
+        EXPECT_EQ(loaded.get(i + 1).center(), arr.get(i).center());
+    }
+    EXPECT_DOUBLE_EQ(loaded.total_area(), arr.total_area() + 0.5);
+    std::remove(path.c_str());
+}
+
+TEST(FigureSnapshotTest, InvalidFileAddsNothing) {
+    FigureArray arr;
+    parse_figures(arr, "triangle 0 0 1 0 0 1 square 0 0 2 0 2 2 0 2 octagon 0 1 1 2 2 2 3 1 3 0 2 -1 1 -1 0 0");
+    std::string path = "figure_snapshot_test.bin";
+    save_snapshot(arr, path);
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    auto rewrite = [&](const std::string& data) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << data;
+    };
+
+    FigureArray loaded;
+    // Обрезанный файл, чужой файл, неизвестный тег у второй записи
+    rewrite(bytes.substr(0, bytes.size() - 8));
+    EXPECT_THROW(load_snapshot(loaded, path), std::invalid_argument);
+    rewrite("triangle 0 0 1 0 0 1 and some more text");
+    EXPECT_THROW(load_snapshot(loaded, path), std::invalid_argument);
+    std::string bad_tag = bytes;
+    bad_tag[32 + 8 + 3 * 16] = 9;
+    rewrite(bad_tag);
+    EXPECT_THROW(load_snapshot(loaded, path), std::invalid_argument);
+
+    // Структура верна, но фигуры нет: вырожденный треугольник, не квадрат, самопересекающийся обход,
+    // восьмиугольник, записанный звездой (повороты одного знака, но обход трижды огибает центр)
+    auto with_points = [&](size_t offset, std::initializer_list<Point> points) {
+        std::string data = bytes;
+        std::memcpy(data.data() + offset, std::data(points), points.size() * sizeof(Point));
+        return data;
+    };
+    const size_t triangle_points = 32 + 8;
+    const size_t square_points = triangle_points + 3 * 16 + 8;
+    const size_t octagon_points = square_points + 4 * 16 + 8;
+    const Point* octagon = arr.get(2).get_vertices();
+    std::initializer_list<Point> octagram = {octagon[0], octagon[3], octagon[6], octagon[1],
+                                             octagon[4], octagon[7], octagon[2], octagon[5]};
+    for (const std::string& data : {with_points(triangle_points, {{0, 0}, {1, 1}, {2, 2}}),
+                                    with_points(square_points, {{0, 0}, {3, 0}, {2, 2}, {0, 2}}),
+                                    with_points(square_points, {{0, 0}, {2, 2}, {2, 0}, {0, 2}}),
+                                    with_points(octagon_points, octagram)}) {
+        rewrite(data);
+        EXPECT_THROW(load_snapshot(loaded, path), std::invalid_argument);
+    }
+    EXPECT_EQ(loaded.get_size(), 0);
+    EXPECT_EQ(loaded.total_area(), 0.0);
+    std::remove(path.c_str());
+
+    EXPECT_THROW(load_snapshot(loaded, "no_such_file.bin"), std::runtime_error);
+}
+
+TEST(AffineTransformTest, KeepsCachesConsistent) {
+    FigureArray arr;
+    parse_figures(arr,
+        "triangle 0 0 4 0 0 3\n"
+        "square 1 1 3 1 3 3 1 3\n"
+        "octagon 0 1 1 2 2 2 3 1 3 0 2 -1 1 -1 0 0\n"
+        "polygon 5 0 0 4 0 4 4 0 4 2 2\n");
+    for (size_t i = 0; i < arr.get_size(); ++i) arr.get(i).center();
+
+    // Площадь и центр по вершинам без запомненных значений
+    auto shoelace = [](const Figure& f) {
+        const Point* v = f.get_vertices();
+        size_t n = f.get_vertices_num();
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            sum += v[i].x * v[(i + 1) % n].y - v[(i + 1) % n].x * v[i].y;
+        }
+        return 0.5 * fabs(sum);
+    };
+    auto mean = [](const Figure& f) {
+        Point c;
+        for (size_t i = 0; i < f.get_vertices_num(); ++i) c = c + f.get_vertices()[i];
+        return c / f.get_vertices_num();
+    };
+
+    // Поворот с растяжением и отражение: вершины остаются упорядоченными
+    AffineTransform m = AffineTransform::translation(5, -2) * AffineTransform::rotation(0.7, {1, 1}) *
+                        AffineTransform::scaling(-1.5, 1.5);
+    double total = arr.total_area();
+    arr.transform(m, 2);
+    EXPECT_NEAR(arr.total_area(), total * 2.25, 1e-9);
+    EXPECT_NEAR(arr.compute_total_area(), arr.total_area(), 1e-9);
+    for (size_t i = 0; i < arr.get_size(); ++i) {
+        const Figure& f = arr.get(i);
+        EXPECT_NEAR(static_cast<double>(f), shoelace(f), 1e-9);
+        EXPECT_NEAR(f.center().x, mean(f).x, 1e-9);
+        EXPECT_NEAR(f.center().y, mean(f).y, 1e-9);
+
+        std::vector<Point> ordered(f.get_vertices(), f.get_vertices() + f.get_vertices_num());
+        order_vertices(ordered.data(), ordered.size(), f.center());
+        EXPECT_TRUE(std::equal(ordered.begin(), ordered.end(), f.get_vertices()));
+    }
+    EXPECT_EQ(arr.get(0).bounding_box().min.x, std::min({arr.get(0).get_vertices()[0].x,
+        arr.get(0).get_vertices()[1].x, arr.get(0).get_vertices()[2].x}));
+
+    // Сдвиг вдоль оси не подходит квадрату: массив не меняется, но треугольники сдвигаются отдельно
+    AffineTransform shear{1, 0.5, 0, 0, 1, 0};
+    std::ostringstream before, after;
+    before << arr;
+    EXPECT_THROW(arr.transform(shear), std::invalid_argument);
+    EXPECT_THROW(arr.transform(AffineTransform::scaling(0, 1)), std::invalid_argument);
+    after << arr;
+    EXPECT_EQ(before.str(), after.str());
+
+    total = arr.total_area();
+    double triangle = static_cast<double>(arr.get(0));
+    arr.set_storage(FigureArray::Storage::Columns);
+    arr.transform(AffineTransform::scaling(2, 3), "triangle");
+    EXPECT_NEAR(static_cast<double>(arr.get(0)), triangle * 6, 1e-9);
+    EXPECT_NEAR(arr.total_area(), total + triangle * 5, 1e-9);
+    EXPECT_NEAR(arr.compute_total_area(), arr.total_area(), 1e-9);
+    arr.transform(shear, "octagon");
+    EXPECT_NEAR(arr.compute_total_area(), arr.total_area(), 1e-9);
+}
+
+// Векторные ядра дают те же значения, что AffineTransform::apply, на любом процессоре
+TEST(AffineTransformTest, KernelsMatchApplyExactly) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+    AffineTransform m = AffineTransform::translation(0.1, -0.3) * AffineTransform::rotation(0.7, {1.3, 2.9}) *
+                        AffineTransform::scaling(1.7, 0.3);
+
+    std::vector<Point> points(37);
+    for (auto& p : points) p = {coord(rng), coord(rng)};
+    std::vector<double> xs, ys;
+    for (const auto& p : points) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+    std::vector<Point> transformed = points;
+    transform_points(transformed.data(), transformed.size(), m);
+    transform_columns(xs.data(), ys.data(), xs.size(), m);
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        Point expected = m.apply(points[i]);
+        EXPECT_EQ(transformed[i].x, expected.x);
+        EXPECT_EQ(transformed[i].y, expected.y);
+        EXPECT_EQ(xs[i], expected.x);
+        EXPECT_EQ(ys[i], expected.y);
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
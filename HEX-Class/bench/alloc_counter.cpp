@@ -0,0 +1,48 @@
+#include "alloc_counter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace alloc_counter {
+
+std::atomic<size_t> bytes(0);
+std::atomic<size_t> calls(0);
+
+} // namespace alloc_counter
+
+namespace {
+
+void* countedAlloc(size_t size, size_t align) {
+    alloc_counter::bytes.fetch_add(size, std::memory_order_relaxed);
+    alloc_counter::calls.fetch_add(1, std::memory_order_relaxed);
+    void* p = align <= alignof(std::max_align_t)
+        ? std::malloc(size == 0 ? 1 : size)
+        : std::aligned_alloc(align, (size + align - 1) / align * align);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return countedAlloc(size, alignof(std::max_align_t)); }
+
+void* operator new[](size_t size) { return countedAlloc(size, alignof(std::max_align_t)); }
+
+void* operator new(size_t size, std::align_val_t align) { return countedAlloc(size, static_cast<size_t>(align)); }
+
+void* operator new[](size_t size, std::align_val_t align) { return countedAlloc(size, static_cast<size_t>(align)); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Счетчики глобального выделения памяти. Подмена operator new/delete лежит в alloc_counter.cpp,
+// который собирается в каждый бенчмарк отдельно.
+namespace alloc_counter {
+
+extern std::atomic<size_t> bytes;   // Всего выделено байт
+extern std::atomic<size_t> calls;   // Всего вызовов operator new
+
+} // namespace alloc_counter
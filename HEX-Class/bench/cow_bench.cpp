@@ -0,0 +1,36 @@
+#include "../include/Hex.hpp"
+#include "alloc_counter.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+// Замер одного способа копирования: значение кладется в containersNum контейнеров
+template <typename CopyFunc>
+static void run(const char* name, const Hex& value, size_t containersNum, CopyFunc copy) {
+    std::vector<std::vector<Hex>> containers(containersNum);
+    for (auto& container : containers) container.reserve(1);
+
+    size_t bytesBefore = alloc_counter::bytes;
+    auto start = std::chrono::steady_clock::now();
+    for (auto& container : containers) {
+        container.push_back(copy(value));
+    }
+    auto finish = std::chrono::steady_clock::now();
+
+    double ms = std::chrono::duration<double, std::milli>(finish - start).count();
+    std::cout << name << ": " << ms << " ms, "
+              << (alloc_counter::bytes - bytesBefore) << " bytes allocated" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    size_t digits = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    size_t containersNum = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+
+    Hex value(std::string(digits, 'F'));
+    std::cout << "Value: " << digits << " digits, containers: " << containersNum << std::endl;
+
+    run("deep copy    ", value, containersNum, [](const Hex& h) { return h.deepCopy(); });
+    run("copy-on-write", value, containersNum, [](const Hex& h) { return Hex(h); });
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include "../include/Hex.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <unordered_map>
+
+// Генератор псевдослучайных ключей (splitmix64)
+static uint64_t nextRandom(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static std::string randomKey(uint64_t& state) {
+    static const char DIGITS[] = "0123456789ABCDEF";
+    uint64_t value = nextRandom(state) | (uint64_t(1) << 63);
+    std::string key(16, '0');
+    for (size_t i = 0; i < 16; ++i) {
+        key[15 - i] = DIGITS[(value >> (4 * i)) & 0xF];
+    }
+    return key;
+}
+
+static double msSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Вставка всех ключей и поиск каждого из них в unordered_map<Key, size_t>
+template <typename Key>
+static void run(const char* name, const std::vector<Key>& keys) {
+    std::unordered_map<Key, size_t> map;
+    map.reserve(keys.size());
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map.emplace(keys[i], i);
+    }
+    double insertMs = msSince(start);
+
+    start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (size_t i = keys.size(); i-- > 0;) {
+        found += map.find(keys[i])->second == i;
+    }
+    double lookupMs = msSince(start);
+
+    std::cout << name << ": insert " << insertMs << " ms, lookup " << lookupMs << " ms ("
+              << lookupMs * 1e6 / keys.size() << " ns/lookup), found " << found << std::endl;
+}
+
+int main(int argc, char** argv) {
+    size_t keysNum = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    std::vector<std::string> stringKeys;
+    std::vector<Hex> hexKeys;
+    stringKeys.reserve(keysNum);
+    hexKeys.reserve(keysNum);
+    uint64_t state = 42;
+    for (size_t i = 0; i < keysNum; ++i) {
+        stringKeys.push_back(randomKey(state));
+        hexKeys.emplace_back(stringKeys.back());
+    }
+    std::cout << "Keys: " << keysNum << std::endl;
+
+    run("std::string keys", stringKeys);
+    run("Hex keys        ", hexKeys);
+
+    // Прежний способ: ключи-строки, каждый Hex переводится в строку при поиске
+    std::unordered_map<std::string, size_t> map;
+    map.reserve(keysNum);
+    for (size_t i = 0; i < keysNum; ++i) {
+        map.emplace(hexKeys[i].toString(), i);
+    }
+    auto start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (size_t i = keysNum; i-- > 0;) {
+        found += map.find(hexKeys[i].toString())->second == i;
+    }
+    double lookupMs = msSince(start);
+    std::cout << "Hex->string keys: lookup " << lookupMs << " ms (" << lookupMs * 1e6 / keysNum
+              << " ns/lookup), found " << found << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include "../include/Hex.hpp"
+#include "alloc_counter.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+// Замер операций класса Hex на операндах от 1 до maxDigits цифр (по степеням 10).
+// Для каждой операции печатается время и объем выделенной памяти на одну операцию.
+//
+// Использование: hex_bench [--format table|csv|json] [--max-digits N] [--min-time-ms N]
+
+namespace {
+
+struct Result {
+    std::string op;
+    size_t digits;
+    size_t iterations;
+    double nsPerOp;
+    double bytesPerOp;
+    double allocsPerOp;
+};
+
+// Значение, которое компилятор не может выбросить
+volatile size_t sink = 0;
+
+// Случайное число из digits цифр без незначащих нулей
+std::string randomDigits(size_t digits, std::mt19937_64& rng) {
+    static const char DIGITS[] = "0123456789ABCDEF";
+    std::string result(digits, '0');
+    for (auto& ch : result) ch = DIGITS[rng() % 16];
+    result[0] = DIGITS[1 + rng() % 15];
+    return result;
+}
+
+// Повторение op, пока суммарное время не превысит minTime; память считается на первом проходе
+template <typename Op>
+Result measure(const std::string& name, size_t digits, std::chrono::nanoseconds minTime, Op op) {
+    size_t bytesBefore = alloc_counter::bytes;
+    size_t callsBefore = alloc_counter::calls;
+    op();
+    double bytes = static_cast<double>(alloc_counter::bytes - bytesBefore);
+    double calls = static_cast<double>(alloc_counter::calls - callsBefore);
+
+    size_t iterations = 1;
+    while (true) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) op();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed >= minTime || iterations >= (size_t(1) << 30)) {
+            double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+            return {name, digits, iterations, ns, bytes, calls};
+        }
+        iterations *= 2;
+    }
+}
+
+void printTable(const std::vector<Result>& results) {
+    std::printf("%-12s %10s %12s %14s %14s %12s\n", "op", "digits", "iterations", "ns/op", "bytes/op", "allocs/op");
+    for (const auto& r : results) {
+        std::printf("%-12s %10zu %12zu %14.1f %14.1f %12.2f\n",
+                    r.op.c_str(), r.digits, r.iterations, r.nsPerOp, r.bytesPerOp, r.allocsPerOp);
+    }
+}
+
+void printCsv(const std::vector<Result>& results) {
+    std::printf("op,digits,iterations,ns_per_op,bytes_per_op,allocs_per_op\n");
+    for (const auto& r : results) {
+        std::printf("%s,%zu,%zu,%.3f,%.1f,%.3f\n",
+                    r.op.c_str(), r.digits, r.iterations, r.nsPerOp, r.bytesPerOp, r.allocsPerOp);
+    }
+}
+
+void printJson(const std::vector<Result>& results) {
+    std::printf("[\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::printf("  {\"op\": \"%s\", \"digits\": %zu, \"iterations\": %zu, \"ns_per_op\": %.3f, "
+                    "\"bytes_per_op\": %.1f, \"allocs_per_op\": %.3f}%s\n",
+                    r.op.c_str(), r.digits, r.iterations, r.nsPerOp, r.bytesPerOp, r.allocsPerOp,
+                    i + 1 < results.size() ? "," : "");
+    }
+    std::printf("]\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string format = "table";
+    size_t maxDigits = 1000000;
+    long minTimeMs = 50;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            format = argv[++i];
+        } else if (std::strcmp(argv[i], "--max-digits") == 0 && i + 1 < argc) {
+            maxDigits = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+            minTimeMs = std::strtol(argv[++i], nullptr, 10);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--format table|csv|json] [--max-digits N] [--min-time-ms N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (format != "table" && format != "csv" && format != "json") {
+        std::fprintf(stderr, "Unknown format: %s\n", format.c_str());
+        return 1;
+    }
+
+    std::chrono::nanoseconds minTime = std::chrono::milliseconds(minTimeMs);
+    std::mt19937_64 rng(42);
+    std::vector<Result> results;
+
+    for (size_t digits = 1; digits <= maxDigits; digits *= 10) {
+        std::string text = randomDigits(digits, rng);
+        std::vector<unsigned char> vec(text.begin(), text.end());
+        Hex a(text);
+        Hex b(randomDigits(digits, rng));
+
+        // Для вычитания уменьшаемое не меньше вычитаемого
+        Hex larger = a.greater(b) ? a : b;
+        Hex smaller = a.greater(b) ? b : a;
+
+        // Числа, отличающиеся только младшей цифрой: сравнение проходит все цифры
+        std::string nearText = text;
+        nearText.back() = nearText.back() == '0' ? '1' : '0';
+        Hex near(nearText);
+
+        results.push_back(measure("ctor_string", digits, minTime, [&] { Hex h(text); sink = sink + h.getSize(); }));
+        results.push_back(measure("ctor_vector", digits, minTime, [&] { Hex h(vec); sink = sink + h.getSize(); }));
+        results.push_back(measure("copy", digits, minTime, [&] { Hex h(a); sink = sink + h.getSize(); }));
+        results.push_back(measure("deep_copy", digits, minTime, [&] { Hex h = a.deepCopy(); sink = sink + h.getSize(); }));
+        results.push_back(measure("add", digits, minTime, [&] { Hex h = a.add(b); sink = sink + h.getSize(); }));
+        results.push_back(measure("subtract", digits, minTime, [&] { Hex h = larger.subtract(smaller); sink = sink + h.getSize(); }));
+        results.push_back(measure("equals", digits, minTime, [&] { sink = sink + a.equals(near); }));
+        results.push_back(measure("greater", digits, minTime, [&] { sink = sink + a.greater(near); }));
+        results.push_back(measure("less", digits, minTime, [&] { sink = sink + a.less(near); }));
+        results.push_back(measure("hash", digits, minTime, [&] { sink = sink + a.hash(); }));
+    }
+
+    if (format == "csv") {
+        printCsv(results);
+    } else if (format == "json") {
+        printJson(results);
+    } else {
+        printTable(results);
+    }
+    return 0;
+}
@@ -3,22 +3,36 @@
 #include <string>
 #include <iostream>
 #include <vector>
+#include <cstdint>
+#include <atomic>
+#include <memory_resource>
+#include <compare>
+#include <functional>
 
 class Hex {
 public:
     // === КОНСТРУКТОРЫ ===
-    
+
+    // Все конструкторы принимают ресурс памяти, из которого берется буфер с цифрами.
+    // Результаты операций наследуют ресурс левого операнда.
+
     // Конструктор по умолчанию
     Hex();
-    
+
+    // Пустое число с заданным ресурсом памяти
+    explicit Hex(std::pmr::memory_resource* resource);
+
     // Конструктор из списка инициализации (C++11)
-    Hex(const std::initializer_list<unsigned char>& initialValues);
-    
+    Hex(const std::initializer_list<unsigned char>& initialValues,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
     // Конструктор из строки
-    Hex(const std::string& sourceString);
+    Hex(const std::string& sourceString,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     // Конструктор из вектора
-    Hex(const std::vector<unsigned char>& sourceVector);
+    Hex(const std::vector<unsigned char>& sourceVector,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     // === ГЕТТЕРЫ ===
 
@@ -27,25 +41,66 @@ public:
 
     // Геттер для цифры числа
     unsigned char getDigit(size_t index) const;
-    
+
+    // Ресурс памяти числа
+    std::pmr::memory_resource* getResource() const;
+
+    // Число владельцев буфера с цифрами (0 для пустого числа)
+    size_t useCount() const;
+
+    // Разделяет ли число буфер с другими копиями
+    bool isShared() const;
+
+    // === СЕТТЕРЫ ===
+
+    // Замена цифры числа (отделяет буфер, если он разделяемый)
+    void setDigit(size_t index, unsigned char digit);
+
     // === КОПИРУЮЩИЕ И ПЕРЕМЕЩАЮЩИЕ ОПЕРАЦИИ ===
-    
-    // Копирующий конструктор
+
+    // Копирующий конструктор (копирование при записи: буфер и ресурс разделяются)
     Hex(const Hex& other);
-    
+
+    // Копирование в другой ресурс памяти (буфер разделяется, только если ресурс тот же)
+    Hex(const Hex& other, std::pmr::memory_resource* resource);
+
     // Перемещающий конструктор (C++11)
     Hex(Hex&& other) noexcept;
 
+    // Оператор присваивания копированием (ресурс левого операнда сохраняется)
+    Hex& operator=(const Hex& other);
+
+    // Оператор присваивания перемещением (ресурс левого операнда сохраняется)
+    Hex& operator=(Hex&& other);
+
+    // Глубокая копия с собственным буфером
+    Hex deepCopy() const;
+
     // === ОПЕРАЦИИ С ЧИСЛАМИ ===
-    
+
     // Сложение чисел
     Hex add(const Hex& other);
-    
+
     // Вычитание чисел
     Hex subtract(const Hex& other);
 
+    // Умножение чисел
+    Hex multiply(const Hex& other);
+
+    // Целочисленное деление (деление на ноль - исключение)
+    Hex divide(const Hex& other);
+
+    // Остаток от деления (деление на ноль - исключение)
+    Hex mod(const Hex& other);
+
+    // Сдвиг влево на bits двоичных разрядов
+    Hex shiftLeft(size_t bits);
+
+    // Сдвиг вправо на bits двоичных разрядов
+    Hex shiftRight(size_t bits);
+
     // === ОПЕРАЦИИ СРАВНЕНИЯ ===
-    
+
     // Сравнение чисел на равенство
     bool equals(const Hex& other) const;
 
@@ -54,18 +109,70 @@ public:
 
     // Сравнение чисел (знак меньше)
     bool less(const Hex& other) const;
-    
+
+    // Трехстороннее сравнение (по 8 цифр за раз от старших к младшим)
+    std::strong_ordering operator<=>(const Hex& other) const;
+
+    // Сравнение на равенство
+    bool operator==(const Hex& other) const;
+
+    // 64-битный хеш цифр числа (для std::hash)
+    size_t hash() const;
+
     // Вывод массива в поток
     std::ostream& print(std::ostream& outputStream);
 
+    // Запись числа строкой (старшие цифры впереди)
+    std::string toString() const;
+
     // === ДЕСТРУКТОР ===
-    
+
     // Виртуальный деструктор
     virtual ~Hex() noexcept;
 
 private:
+    // === РАЗДЕЛЯЕМЫЙ БУФЕР ===
+
+    // Заголовок буфера, сразу за ним в той же памяти лежат цифры числа
+    struct Buffer {
+        std::atomic<size_t> refs;                 // Число владельцев буфера
+        size_t capacity;                          // Размер области под цифры
+        std::pmr::memory_resource* resource;      // Ресурс, из которого выделен буфер
+    };
+
+    // Выделение буфера под numDigits цифр с одним владельцем
+    static Buffer* allocateBuffer(size_t numDigits, std::pmr::memory_resource* resource);
+
+    // Выделение собственного буфера под numDigits цифр из ресурса числа
+    void allocate(size_t numDigits);
+
+    // Отказ от владения буфером (последний владелец освобождает память)
+    void release() noexcept;
+
+    // Получение собственного буфера перед изменением цифр
+    void detach();
+
+    // Деление с остатком, quotient и remainder могут быть nullptr
+    void divideWithRemainder(const Hex& other, Hex* quotient, Hex* remainder) const;
+
+    // Удаление незначащих нулей в старших цифрах
+    void trim();
+
+    // Число из двоичных 32-битных разрядов (младший разряд первый)
+    static Hex fromLimbs(const std::pmr::vector<uint32_t>& limbs, std::pmr::memory_resource* resource);
+
     // === ДАННЫЕ-ЧЛЕНЫ ===
 
+    std::pmr::memory_resource* resource;   // Ресурс памяти для буферов числа
     size_t numSize;           // Размер числа
-    unsigned char* dataHex;   // Указатель на динамический массив с числом
+    Buffer* buffer;           // Разделяемый буфер (nullptr для пустого числа)
+    unsigned char* dataHex;   // Указатель на цифры внутри буфера
+};
+
+// Хеш для использования Hex как ключа в неупорядоченных контейнерах
+template <>
+struct std::hash<Hex> {
+    size_t operator()(const Hex& value) const noexcept {
+        return value.hash();
+    }
 };
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Hex.hpp"
+
+// Пакет чисел одинаковой ширины для поэлементных операций.
+// Числа хранятся в двоичных 64-битных разрядах (по 16 цифр) в одном непрерывном буфере,
+// разряды перемежаются: сначала младший разряд всех чисел, затем следующий и т.д.
+// Такое расположение позволяет векторизовать проход по пакету для каждого разряда.
+class HexBatch {
+public:
+    // Число 16-ричных цифр в одном разряде
+    static constexpr size_t DIGITS_PER_LIMB = 16;
+
+    // === КОНСТРУКТОРЫ ===
+
+    // Конструктор по умолчанию
+    HexBatch();
+
+    // Пакет из count нулей шириной width цифр
+    HexBatch(size_t count, size_t width);
+
+    // Пакет из чисел (каждое должно помещаться в width цифр)
+    HexBatch(const std::vector<Hex>& values, size_t width);
+
+    // === ГЕТТЕРЫ И СЕТТЕРЫ ===
+
+    // Количество чисел в пакете
+    size_t getSize() const;
+
+    // Ширина чисел в 16-ричных цифрах
+    size_t getWidth() const;
+
+    // Количество 64-битных разрядов на число
+    size_t getLimbs() const;
+
+    // Разряд limb числа index
+    uint64_t getLimb(size_t index, size_t limb) const;
+
+    // Число по индексу
+    Hex get(size_t index) const;
+
+    // Запись числа по индексу
+    void set(size_t index, const Hex& value);
+
+    // === ПОЭЛЕМЕНТНЫЕ ОПЕРАЦИИ ===
+    // threads - число потоков, на которые делится пакет (1 - без потоков)
+
+    // Сложение (переполнение ширины - исключение)
+    HexBatch add(const HexBatch& other, size_t threads = 1) const;
+
+    // Вычитание (отрицательный результат - исключение)
+    HexBatch subtract(const HexBatch& other, size_t threads = 1) const;
+
+    // Сравнение: -1, 0 или 1 для каждой пары чисел
+    std::vector<int> compare(const HexBatch& other, size_t threads = 1) const;
+
+    // Поэлементный минимум
+    HexBatch min(const HexBatch& other, size_t threads = 1) const;
+
+    // Поэлементный максимум
+    HexBatch max(const HexBatch& other, size_t threads = 1) const;
+
+private:
+    // Проверка, что пакеты одного размера и ширины
+    void checkShape(const HexBatch& other) const;
+
+    // Маска допустимых битов старшего разряда
+    uint64_t topMask() const;
+
+    // === ДАННЫЕ-ЧЛЕНЫ ===
+
+    size_t count;                 // Количество чисел
+    size_t width;                 // Ширина в цифрах
+    size_t limbsNum;              // Разрядов на число
+    std::vector<uint64_t> limbs;  // Разряд limb числа i лежит в limbs[limb * count + i]
+};
@@ -1,14 +1,224 @@
 #include "./include/Hex.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory_resource>
+#include <thread>
 
-int main() {
-    Hex a("FFFF");
-    Hex b("1");
-    Hex c = a.add(b);
+// Пакетный калькулятор: каждая строка входа - выражение "A op B" над 16-ричными числами,
+// op - один из + - * / % << >>. Входной поток читается порциями строк, порция делится
+// между потоками, результаты выводятся в порядке входа. Производительность печатается в stderr.
+//
+// Использование: Lab02_exe [вход [выход]] [--threads N] [--chunk N]
+// Без файлов читается stdin и пишется stdout.
 
-    c.print(std::cout);
-    std::cout << std::endl;
+namespace {
 
-    std::cout << "Hex the world!" << std::endl;
+// Буферизованный вывод: данные копятся в строке и сбрасываются крупными блоками
+class BufferedWriter {
+public:
+    explicit BufferedWriter(std::FILE* file) : file(file) {
+        buffer.reserve(CAPACITY);
+    }
+
+    ~BufferedWriter() { flush(); }
+
+    void write(const std::string& data) {
+        buffer += data;
+        if (buffer.size() >= CAPACITY) flush();
+    }
+
+    void flush() {
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+
+private:
+    static constexpr size_t CAPACITY = 1 << 20;
+
+    std::FILE* file;
+    std::string buffer;
+};
+
+// Выделение следующего слова строки, начиная с позиции pos
+std::string nextToken(const std::string& line, size_t& pos) {
+    while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos]))) ++pos;
+    size_t start = pos;
+    while (pos < line.size() && !std::isspace(static_cast<unsigned char>(line[pos]))) ++pos;
+    return line.substr(start, pos - start);
+}
+
+// Разбор 16-ричного литерала (допускаются префикс 0x и строчные цифры)
+Hex parseHex(std::string token, std::pmr::memory_resource* resource) {
+    if (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) {
+        token.erase(0, 2);
+    }
+    if (token.empty()) {
+        throw std::logic_error("Ожидалось 16-ричное число");
+    }
+    for (auto& ch : token) ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+    return Hex(token, resource);
+}
+
+// Наибольший сдвиг в битах: результат не длиннее 128 КиБ
+constexpr size_t MAX_SHIFT = size_t{1} << 20;
+
+// Величина сдвига из 16-ричного числа
+size_t shiftAmount(const Hex& value) {
+    if (value.getSize() > 8) {
+        throw std::logic_error("Слишком большой сдвиг");
+    }
+    size_t shift = std::stoull(value.toString(), nullptr, 16);
+    if (shift > MAX_SHIFT) {
+        throw std::logic_error("Слишком большой сдвиг");
+    }
+    return shift;
+}
+
+// Границы параметров командной строки
+constexpr size_t MAX_THREADS = 1024;
+constexpr size_t MAX_CHUNK = size_t{1} << 24;
+
+// Вычисление одного выражения, все временные числа берутся из resource
+std::string evaluate(const std::string& line, std::pmr::memory_resource* resource) {
+    size_t pos = 0;
+    std::string left = nextToken(line, pos);
+    if (left.empty()) return "";
+    std::string op = nextToken(line, pos);
+    std::string right = nextToken(line, pos);
+    if (!nextToken(line, pos).empty()) {
+        throw std::logic_error("Лишние символы в выражении");
+    }
+
+    Hex a = parseHex(left, resource);
+    Hex b = parseHex(right, resource);
+    if (op == "+") return a.add(b).toString();
+    if (op == "-") return a.subtract(b).toString();
+    if (op == "*") return a.multiply(b).toString();
+    if (op == "/") return a.divide(b).toString();
+    if (op == "%") return a.mod(b).toString();
+    if (op == "<<") return a.shiftLeft(shiftAmount(b)).toString();
+    if (op == ">>") return a.shiftRight(shiftAmount(b)).toString();
+    throw std::logic_error("Неизвестная операция: " + op);
+}
+
+// Вычисление строк [begin, end) порции в out; память временных чисел освобождается разом
+void evaluateRange(const std::vector<std::string>& lines, size_t begin, size_t end, std::string& out) {
+    std::pmr::monotonic_buffer_resource arena;
+    out.clear();
+    for (size_t i = begin; i < end; ++i) {
+        try {
+            out += evaluate(lines[i], &arena);
+        } catch (const std::exception& e) {
+            out += "error: ";
+            out += e.what();
+        }
+        out += '\n';
+    }
+}
+
+// Разбор значения параметра командной строки: целое из [1, limit]
+bool parseCount(const char* text, size_t limit, size_t& value) {
+    if (*text == '\0') return false;
+    for (const char* p = text; *p != '\0'; ++p) {
+        if (!std::isdigit(static_cast<unsigned char>(*p))) return false;
+    }
+    try {
+        value = std::stoull(text);
+    } catch (const std::out_of_range&) {
+        return false;
+    }
+    return value >= 1 && value <= limit;
+}
+
+void printUsage() {
+    std::cerr << "Использование: Lab02_exe [вход [выход]] [--threads N] [--chunk N]\n"
+              << "  --threads N  число потоков, от 1 до " << MAX_THREADS << "\n"
+              << "  --chunk N    строк в порции, от 1 до " << MAX_CHUNK << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string> files;
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t chunk = 1 << 16;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--threads") == 0 || std::strcmp(argv[i], "--chunk") == 0) {
+            bool isThreads = std::strcmp(argv[i], "--threads") == 0;
+            if (i + 1 >= argc || !parseCount(argv[i + 1], isThreads ? MAX_THREADS : MAX_CHUNK,
+                                             isThreads ? threads : chunk)) {
+                std::cerr << "Неверное значение " << argv[i] << std::endl;
+                printUsage();
+                return 1;
+            }
+            ++i;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    std::ifstream inputFile;
+    if (!files.empty()) {
+        inputFile.open(files[0]);
+        if (!inputFile) {
+            std::cerr << "Не удалось открыть " << files[0] << std::endl;
+            return 1;
+        }
+    }
+    std::istream& input = files.empty() ? std::cin : inputFile;
+
+    std::FILE* outputFile = files.size() > 1 ? std::fopen(files[1].c_str(), "wb") : stdout;
+    if (outputFile == nullptr) {
+        std::cerr << "Не удалось открыть " << files[1] << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t linesNum = 0;
+    size_t bytesNum = 0;
+    {
+        BufferedWriter writer(outputFile);
+        std::vector<std::string> lines;
+        std::vector<std::string> results(threads);
+        std::string line;
+
+        while (true) {
+            // Чтение очередной порции
+            lines.clear();
+            while (lines.size() < chunk && std::getline(input, line)) {
+                bytesNum += line.size() + 1;
+                lines.push_back(std::move(line));
+            }
+            if (lines.empty()) break;
+            linesNum += lines.size();
+
+            // Порция делится на непрерывные куски по числу потоков
+            size_t workersNum = std::min(threads, lines.size());
+            size_t part = (lines.size() + workersNum - 1) / workersNum;
+            std::vector<std::thread> workers;
+            for (size_t t = 1; t < workersNum; ++t) {
+                size_t begin = std::min(lines.size(), t * part);
+                size_t end = std::min(lines.size(), begin + part);
+                workers.emplace_back(evaluateRange, std::cref(lines), begin, end, std::ref(results[t]));
+            }
+            evaluateRange(lines, 0, std::min(lines.size(), part), results[0]);
+            for (auto& worker : workers) worker.join();
+
+            // Куски выводятся по порядку, поэтому порядок строк сохраняется
+            for (size_t t = 0; t < workersNum; ++t) {
+                writer.write(results[t]);
+            }
+        }
+    }
+    if (outputFile != stdout) std::fclose(outputFile);
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << linesNum << " expressions, " << bytesNum << " bytes in " << seconds << " s ("
+              << (seconds > 0 ? linesNum / seconds : 0.0) << " expr/s, "
+              << (seconds > 0 ? bytesNum / seconds / (1 << 20) : 0.0) << " MiB/s, "
+              << threads << " threads)" << std::endl;
 
     return 0;
-}
\ No newline at end of file
+}
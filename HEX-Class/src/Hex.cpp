@@ -1,14 +1,129 @@
 #include "../include/Hex.hpp"
 #include <vector>
+#include <cstring>
+#include <bit>
 #include <bits/stdc++.h>
 
+namespace {
+
+// Значение 16-ричной цифры по ее символу
+inline int digitValue(unsigned char ch) {
+    return ch <= '9' ? ch - '0' : ch - 'A' + 10;
+}
+
+// Символ 16-ричной цифры по ее значению
+inline unsigned char digitChar(int value) {
+    return static_cast<unsigned char>(value > 9 ? value + 'A' - 10 : value + '0');
+}
+
+// Загрузка 8 цифр, начиная с index, одним словом: старшая цифра попадает в старший байт.
+// Коды '0'-'9' меньше кодов 'A'-'F', поэтому сравнение слов совпадает со сравнением значений.
+inline uint64_t loadWord(const unsigned char* digits, size_t index) {
+    uint64_t word;
+    std::memcpy(&word, digits + index, sizeof(word));
+    if constexpr (std::endian::native == std::endian::big) {
+        word = __builtin_bswap64(word);
+    }
+    return word;
+}
+
+// Перемешивание битов слова (финализатор MurmurHash3)
+inline uint64_t mix(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+// Перевод цифр в двоичные 32-битные разряды (по 8 цифр, младший разряд первый)
+std::pmr::vector<uint32_t> toLimbs(const unsigned char* digits, size_t size, std::pmr::memory_resource* resource) {
+    std::pmr::vector<uint32_t> limbs(std::max<size_t>((size + 7) / 8, 1), 0, resource);
+    for (size_t i = 0; i < size; ++i) {
+        limbs[i / 8] |= static_cast<uint32_t>(digitValue(digits[i])) << (4 * (i % 8));
+    }
+    return limbs;
+}
+
+// Деление u на v по алгоритму D Кнута (v.size() >= 2, старший разряд v ненулевой, u.size() >= v.size())
+void divideLimbs(const std::pmr::vector<uint32_t>& u, const std::pmr::vector<uint32_t>& v,
+                 std::pmr::vector<uint32_t>& q, std::pmr::vector<uint32_t>& r) {
+    constexpr uint64_t BASE = uint64_t(1) << 32;
+    const size_t m = u.size();
+    const size_t n = v.size();
+    const int s = std::countl_zero(v[n - 1]);
+
+    // Нормализация: сдвигаем делитель так, чтобы старший бит был единицей
+    std::pmr::vector<uint32_t> vn(n, 0, v.get_allocator());
+    std::pmr::vector<uint32_t> un(m + 1, 0, u.get_allocator());
+    for (size_t i = n - 1; i > 0; --i) {
+        vn[i] = static_cast<uint32_t>((uint64_t(v[i]) << s) | (uint64_t(v[i - 1]) >> (32 - s)));
+    }
+    vn[0] = v[0] << s;
+    un[m] = static_cast<uint32_t>(uint64_t(u[m - 1]) >> (32 - s));
+    for (size_t i = m - 1; i > 0; --i) {
+        un[i] = static_cast<uint32_t>((uint64_t(u[i]) << s) | (uint64_t(u[i - 1]) >> (32 - s)));
+    }
+    un[0] = u[0] << s;
+
+    q.assign(m - n + 1, 0);
+    for (size_t j = m - n + 1; j-- > 0;) {
+        // Оценка очередной цифры частного
+        uint64_t numerator = (uint64_t(un[j + n]) << 32) | un[j + n - 1];
+        uint64_t qhat = numerator / vn[n - 1];
+        uint64_t rhat = numerator % vn[n - 1];
+        while (qhat >= BASE || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= BASE) break;
+        }
+
+        // Умножение и вычитание
+        int64_t borrow = 0;
+        int64_t t = 0;
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t p = qhat * vn[i];
+            t = int64_t(un[i + j]) - borrow - int64_t(p & 0xFFFFFFFFULL);
+            un[i + j] = static_cast<uint32_t>(t);
+            borrow = int64_t(p >> 32) - (t >> 32);
+        }
+        t = int64_t(un[j + n]) - borrow;
+        un[j + n] = static_cast<uint32_t>(t);
+
+        q[j] = static_cast<uint32_t>(qhat);
+        if (t < 0) {
+            // Оценка оказалась на единицу больше - возвращаем делитель
+            --q[j];
+            uint64_t carry = 0;
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t sum = uint64_t(un[i + j]) + vn[i] + carry;
+                un[i + j] = static_cast<uint32_t>(sum);
+                carry = sum >> 32;
+            }
+            un[j + n] = static_cast<uint32_t>(un[j + n] + carry);
+        }
+    }
+
+    // Денормализация остатка
+    r.assign(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = static_cast<uint32_t>((uint64_t(un[i]) >> s) | (uint64_t(un[i + 1]) << (32 - s)));
+    }
+}
+
+} // namespace
+
 // === РЕАЛИЗАЦИЯ КОНСТРУКТОРОВ ===
 
 // Конструктор по умолчанию
-Hex::Hex() : numSize(0), dataHex(nullptr) {}
+Hex::Hex() : Hex(std::pmr::get_default_resource()) {}
+
+// Пустое число с заданным ресурсом памяти
+Hex::Hex(std::pmr::memory_resource* resource) : resource(resource), numSize(0), buffer(nullptr), dataHex(nullptr) {}
 
 // Конструктор из списка инициализации (C++11)
-Hex::Hex(const std::initializer_list<unsigned char>& initialValues) {
+Hex::Hex(const std::initializer_list<unsigned char>& initialValues, std::pmr::memory_resource* resource) : Hex(resource) {
     numSize = initialValues.size();
     // Проверка на незначащие нули + на соответсвие цифрам 16-ричного алфавита
     int areInsignifZeros = 1;
@@ -26,12 +141,10 @@ Hex::Hex(const std::initializer_list<unsigned char>& initialValues) {
     }
 
     if (InsignifZerosCounter == numSize) {
-        numSize = 1;
-        dataHex = new unsigned char[numSize];
+        allocate(1);
         dataHex[0] = '0';
     } else {
-        numSize -= InsignifZerosCounter;
-        dataHex = new unsigned char[numSize];
+        allocate(numSize - InsignifZerosCounter);
 
         size_t index = numSize - 1;
         for (const auto& value : initialValues) {
@@ -45,7 +158,7 @@ Hex::Hex(const std::initializer_list<unsigned char>& initialValues) {
 }
 
 // Конструктор из строки
-Hex::Hex(const std::string& sourceString) {
+Hex::Hex(const std::string& sourceString, std::pmr::memory_resource* resource) : Hex(resource) {
     numSize = sourceString.size();
     size_t start = 0;
     while( static_cast<int>(sourceString[start]) == '0' && start + 1 != numSize) {
@@ -53,17 +166,16 @@ Hex::Hex(const std::string& sourceString) {
     }
     numSize -= start;
     if (numSize == 0) {
-        numSize = 1;
-        dataHex = new unsigned char[1];
+        allocate(1);
         dataHex[0] = '0';
     } else {
-        dataHex = new unsigned char[numSize];
-        
-        // Копируем символы из вектора
+        allocate(numSize);
+
+        // Копируем символы из строки
         for (size_t i = 0; i < numSize; ++i) {
             int ch = static_cast<int>(sourceString[i + start]);
             if ( !((ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'F')) ) {
-                delete[] dataHex;
+                release();
                 throw std::logic_error("Число должно быть в 16-ричной системе счисления и не иметь знаков.");
             }
             dataHex[numSize - i - 1] = ch;
@@ -72,7 +184,7 @@ Hex::Hex(const std::string& sourceString) {
 }
 
 // Конструктор из вектора
-Hex::Hex(const std::vector<unsigned char>& sourceVector) {
+Hex::Hex(const std::vector<unsigned char>& sourceVector, std::pmr::memory_resource* resource) : Hex(resource) {
     numSize = sourceVector.size();
     size_t start = 0;
     while( static_cast<int>(sourceVector[start]) == '0' && start + 1 != numSize) {
@@ -80,17 +192,16 @@ Hex::Hex(const std::vector<unsigned char>& sourceVector) {
     }
     numSize -= start;
     if (numSize == 0) {
-        numSize = 1;
-        dataHex = new unsigned char[1];
+        allocate(1);
         dataHex[0] = '0';
     } else {
-        dataHex = new unsigned char[numSize];
-        
+        allocate(numSize);
+
         // Копируем символы из вектора
         for (size_t i = 0; i < numSize; ++i) {
             int ch = static_cast<int>(sourceVector[i + start]);
             if ( !((ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'F')) ) {
-                delete[] dataHex;
+                release();
                 throw std::logic_error("Число должно быть в 16-ричной системе счисления и не иметь знаков.");
             }
             dataHex[numSize - i - 1] = ch;
@@ -98,189 +209,398 @@ Hex::Hex(const std::vector<unsigned char>& sourceVector) {
     }
 }
 
-// Копирующий конструктор (глубокое копирование)
-Hex::Hex(const Hex& other) {
-    numSize = other.numSize;
-    dataHex = new unsigned char[numSize];
-
-    for (size_t i = 0; i < numSize; ++i) {
-        dataHex[i] = other.dataHex[i];
+// Копирующий конструктор (копирование при записи: буфер и ресурс разделяются)
+Hex::Hex(const Hex& other) : resource(other.resource), numSize(other.numSize), buffer(other.buffer), dataHex(other.dataHex) {
+    if (buffer != nullptr) {
+        buffer->refs.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
+// Копирование в другой ресурс памяти (буфер разделяется, только если ресурс тот же)
+Hex::Hex(const Hex& other, std::pmr::memory_resource* resource) : Hex(resource) {
+    *this = other;
+}
+
 // Перемещающий конструктор (C++11)
 Hex::Hex(Hex&& other) noexcept {
+    resource = other.resource;
     numSize = other.numSize;
+    buffer = other.buffer;
     dataHex = other.dataHex;
-    
+
     // Обнуляем другой объект, чтобы деструктор не освободил память
     other.numSize = 0;
+    other.buffer = nullptr;
     other.dataHex = nullptr;
 }
 
+// Оператор присваивания копированием (ресурс левого операнда сохраняется)
+Hex& Hex::operator=(const Hex& other) {
+    if (this == &other) return *this;
+
+    if (other.buffer == nullptr || other.buffer->resource->is_equal(*resource)) {
+        // Тот же ресурс - просто разделяем буфер
+        if (other.buffer != nullptr) {
+            other.buffer->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        release();
+        numSize = other.numSize;
+        buffer = other.buffer;
+        dataHex = other.dataHex;
+    } else {
+        // Другой ресурс - копируем цифры в свой буфер
+        Buffer* own = allocateBuffer(other.numSize, resource);
+        release();
+        numSize = other.numSize;
+        buffer = own;
+        dataHex = reinterpret_cast<unsigned char*>(own + 1);
+        std::memcpy(dataHex, other.dataHex, numSize);
+    }
+    return *this;
+}
+
+// Оператор присваивания перемещением (ресурс левого операнда сохраняется)
+Hex& Hex::operator=(Hex&& other) {
+    if (this == &other) return *this;
+
+    if (other.buffer != nullptr && !other.buffer->resource->is_equal(*resource)) {
+        return *this = static_cast<const Hex&>(other);
+    }
+    release();
+    numSize = other.numSize;
+    buffer = other.buffer;
+    dataHex = other.dataHex;
+    other.numSize = 0;
+    other.buffer = nullptr;
+    other.dataHex = nullptr;
+    return *this;
+}
+
+// Глубокая копия с собственным буфером
+Hex Hex::deepCopy() const {
+    Hex copy(resource);
+    if (numSize > 0) {
+        copy.allocate(numSize);
+        std::memcpy(copy.dataHex, dataHex, numSize);
+    }
+    return copy;
+}
+
+// === РАБОТА С РАЗДЕЛЯЕМЫМ БУФЕРОМ ===
+
+// Выделение буфера под numDigits цифр с одним владельцем
+Hex::Buffer* Hex::allocateBuffer(size_t numDigits, std::pmr::memory_resource* resource) {
+    void* memory = resource->allocate(sizeof(Buffer) + numDigits, alignof(Buffer));
+    Buffer* result = new (memory) Buffer;
+    result->refs.store(1, std::memory_order_relaxed);
+    result->capacity = numDigits;
+    result->resource = resource;
+    return result;
+}
+
+// Выделение собственного буфера под numDigits цифр из ресурса числа
+void Hex::allocate(size_t numDigits) {
+    release();
+    buffer = allocateBuffer(numDigits, resource);
+    dataHex = reinterpret_cast<unsigned char*>(buffer + 1);
+    numSize = numDigits;
+}
+
+// Отказ от владения буфером (последний владелец освобождает память)
+void Hex::release() noexcept {
+    if (buffer != nullptr && buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::pmr::memory_resource* owner = buffer->resource;
+        size_t bytes = sizeof(Buffer) + buffer->capacity;
+        buffer->~Buffer();
+        owner->deallocate(buffer, bytes, alignof(Buffer));
+    }
+    buffer = nullptr;
+    dataHex = nullptr;
+}
+
+// Получение собственного буфера перед изменением цифр
+void Hex::detach() {
+    if (buffer == nullptr || buffer->refs.load(std::memory_order_acquire) == 1) return;
+
+    Buffer* own = allocateBuffer(numSize, resource);
+    unsigned char* ownData = reinterpret_cast<unsigned char*>(own + 1);
+    std::memcpy(ownData, dataHex, numSize);
+    size_t size = numSize;
+    release();
+    numSize = size;
+    buffer = own;
+    dataHex = ownData;
+}
+
 // === РЕАЛИЗАЦИЯ ГЕТТЕРОВ ===
 
 size_t Hex::getSize() const { return this->numSize; }
 
 unsigned char Hex::getDigit(size_t index) const { return this->dataHex[index]; }
 
+std::pmr::memory_resource* Hex::getResource() const { return this->resource; }
+
+size_t Hex::useCount() const {
+    return buffer == nullptr ? 0 : buffer->refs.load(std::memory_order_relaxed);
+}
+
+bool Hex::isShared() const { return useCount() > 1; }
+
+// === РЕАЛИЗАЦИЯ СЕТТЕРОВ ===
+
+// Замена цифры числа (отделяет буфер, если он разделяемый)
+void Hex::setDigit(size_t index, unsigned char digit) {
+    if (index >= numSize) {
+        throw std::out_of_range("Индекс цифры вне диапазона числа.");
+    }
+    if ( !((digit >= '0' && digit <= '9') || (digit >= 'A' && digit <= 'F')) ) {
+        throw std::logic_error("Число должно быть в 16-ричной системе счисления и не иметь знаков.");
+    }
+    if (dataHex[index] == digit) return;
+
+    detach();
+    dataHex[index] = digit;
+
+    // Убираем появившиеся незначащие нули
+    trim();
+}
+
 // === РЕАЛИЗАЦИЯ ОПЕРАЦИЙ ===
 
-// Сложение чисел
+// Сложение чисел (результат пишется сразу в буфер из ресурса левого операнда)
 Hex Hex::add(const Hex& other) {
-    std::vector<unsigned char> result;
     size_t max_size = std::max(this->numSize, other.numSize);
-    size_t i = 0;
-    int k = 0;
-    unsigned char ch;
+    Hex result(resource);
+    result.allocate(max_size + 1);
 
-    for (; i < max_size; ++i) {
-        int num = 0;
-        int cur = 0;
+    int k = 0;
+    for (size_t i = 0; i < max_size; ++i) {
         int sum = k;
-        if (i < this->numSize) {
-            if (!isdigit(this->dataHex[i])) {
-                cur = static_cast<int> (this->dataHex[i] - 'A' + 10);
-            } else {
-                cur = static_cast<int> (this->dataHex[i] - '0');
-            }            
-        } else {
-            cur = 0;
-        }
-        sum += cur;
-
-        if (i < other.numSize) {
-            if (!isdigit(other.dataHex[i])) {
-                cur = static_cast<int> (other.dataHex[i] - 'A' + 10);
-            } else {
-                cur = static_cast<int> (other.dataHex[i] - '0');
-            }
-        } else {
-            cur = 0;
-        }
-        sum += cur;
+        if (i < this->numSize) sum += digitValue(this->dataHex[i]);
+        if (i < other.numSize) sum += digitValue(other.dataHex[i]);
 
-        num = sum % 16;
+        result.dataHex[i] = digitChar(sum % 16);
         k = sum / 16;
-        if (num > 9) {
-            ch = static_cast<unsigned char> (num + 'A' - 10);
-        } else {
-            ch = static_cast<unsigned char> (num + '0');
-        }
-
-        result.push_back(ch);
     }
 
     if (k > 0) {
-        if (k > 9) {
-            ch = static_cast<unsigned char>(k + 'A' - 10);
-        } else {
-            ch = static_cast<unsigned char>(k + '0');
-        }
-        result.push_back(ch);
+        result.dataHex[max_size] = digitChar(k);
+    } else {
+        result.numSize = std::max<size_t>(max_size, 1);
+        if (max_size == 0) result.dataHex[0] = '0';
     }
-
-    std::reverse(result.begin(), result.end());
-    return Hex(result);
+    return result;
 }
 
-// Вычитание чисел
+// Вычитание чисел (результат пишется сразу в буфер из ресурса левого операнда)
 Hex Hex::subtract(const Hex& other) {
     if (other.numSize > this->numSize) {
         throw std::logic_error("Результат вычислений не может быть отрицательным");
     }
 
-    std::vector<unsigned char> result;
     size_t sz = this->numSize;
-    size_t i = 0;
-    int k = 0;
-    unsigned char ch;
-
-    for (; i < sz; ++i) {
-        int num = 0;
-        int cur1 = 0;
-        int cur2 = 0;
-        int sub = 0;
-        if (!isdigit(this->dataHex[i])) {
-            cur1 = static_cast<int> (this->dataHex[i] - 'A' + 10);
-        } else {
-            cur1 = static_cast<int> (this->dataHex[i] - '0');
-        }
-        sub = cur1;
+    Hex result(resource);
+    result.allocate(std::max<size_t>(sz, 1));
+    result.dataHex[0] = '0';
 
-        if (i < other.numSize) {
-            if (!isdigit(other.dataHex[i])) {
-                cur2 = static_cast<int> (other.dataHex[i] - 'A' + 10);
-            } else {
-                cur2 = static_cast<int> (other.dataHex[i] - '0');
-            }
-        } else {
-            cur2 = 0;
-        }
+    int k = 0;
+    for (size_t i = 0; i < sz; ++i) {
+        int sub = digitValue(this->dataHex[i]) - k;
+        if (i < other.numSize) sub -= digitValue(other.dataHex[i]);
 
-        if (cur1 - k < cur2) {
+        if (sub < 0) {
             sub += 16;
-            sub = sub - k - cur2;
             k = 1;
         } else {
-            sub = sub - k - cur2;
             k = 0;
         }
+        result.dataHex[i] = digitChar(sub);
+    }
+
+    if (k > 0) {
+        throw std::logic_error("Результат вычислений не может быть отрицательным");
+    }
 
-        num = sub % 16;
+    // Убираем незначащие нули
+    result.trim();
+    return result;
+}
 
-        if (num > 9) {
-            ch = static_cast<unsigned char> (num + 'A' - 10);
-        } else {
-            ch = static_cast<unsigned char> (num + '0');
+// Умножение чисел (в столбик по 32-битным разрядам)
+Hex Hex::multiply(const Hex& other) {
+    std::pmr::vector<uint32_t> a = toLimbs(this->dataHex, this->numSize, resource);
+    std::pmr::vector<uint32_t> b = toLimbs(other.dataHex, other.numSize, resource);
+    std::pmr::vector<uint32_t> product(a.size() + b.size(), 0, resource);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < b.size(); ++j) {
+            uint64_t cur = uint64_t(a[i]) * b[j] + product[i + j] + carry;
+            product[i + j] = static_cast<uint32_t>(cur);
+            carry = cur >> 32;
         }
+        product[i + b.size()] = static_cast<uint32_t>(carry);
+    }
+    return fromLimbs(product, resource);
+}
+
+// Целочисленное деление (деление на ноль - исключение)
+Hex Hex::divide(const Hex& other) {
+    Hex quotient(resource);
+    divideWithRemainder(other, &quotient, nullptr);
+    return quotient;
+}
+
+// Остаток от деления (деление на ноль - исключение)
+Hex Hex::mod(const Hex& other) {
+    Hex remainder(resource);
+    divideWithRemainder(other, nullptr, &remainder);
+    return remainder;
+}
 
-        result.push_back(ch);
+// Сдвиг влево на bits двоичных разрядов
+Hex Hex::shiftLeft(size_t bits) {
+    size_t digitShift = bits / 4;
+    int bitShift = static_cast<int>(bits % 4);
+    Hex result(resource);
+    result.allocate(std::max<size_t>(numSize, 1) + digitShift + 1);
+    std::memset(result.dataHex, '0', result.numSize);
+
+    int carry = 0;
+    for (size_t i = 0; i < numSize; ++i) {
+        int value = (digitValue(dataHex[i]) << bitShift) | carry;
+        result.dataHex[i + digitShift] = digitChar(value & 0xF);
+        carry = value >> 4;
     }
+    result.dataHex[numSize + digitShift] = digitChar(carry);
+    result.trim();
+    return result;
+}
 
-    if (k > 0) {
-        throw std::logic_error("Результат вычислений не может быть отрицательным");
+// Сдвиг вправо на bits двоичных разрядов
+Hex Hex::shiftRight(size_t bits) {
+    size_t digitShift = bits / 4;
+    int bitShift = static_cast<int>(bits % 4);
+    Hex result(resource);
+    if (digitShift >= numSize) {
+        result.allocate(1);
+        result.dataHex[0] = '0';
+        return result;
     }
 
-    for (int i = 0; i < result.size(); ++i) std::cout << result[i] << std::endl;
+    result.allocate(numSize - digitShift);
+    for (size_t i = 0; i < result.numSize; ++i) {
+        int low = digitValue(dataHex[i + digitShift]);
+        int high = i + digitShift + 1 < numSize ? digitValue(dataHex[i + digitShift + 1]) : 0;
+        result.dataHex[i] = digitChar(((low >> bitShift) | (high << (4 - bitShift))) & 0xF);
+    }
+    result.trim();
+    return result;
+}
 
-    Hex a(result);
-    a.print(std::cout);
+// Деление с остатком, quotient и remainder могут быть nullptr
+void Hex::divideWithRemainder(const Hex& other, Hex* quotient, Hex* remainder) const {
+    std::pmr::vector<uint32_t> u = toLimbs(this->dataHex, this->numSize, resource);
+    std::pmr::vector<uint32_t> v = toLimbs(other.dataHex, other.numSize, resource);
+    while (u.size() > 1 && u.back() == 0) u.pop_back();
+    while (v.size() > 1 && v.back() == 0) v.pop_back();
+    if (v.size() == 1 && v[0] == 0) {
+        throw std::logic_error("Деление на ноль");
+    }
 
-    std::cout << "asdfvb " << std::endl;
+    std::pmr::vector<uint32_t> q(resource);
+    std::pmr::vector<uint32_t> r(resource);
+    if (u.size() < v.size()) {
+        q.assign(1, 0);
+        r = u;
+    } else if (v.size() == 1) {
+        // Деление на один разряд
+        q.assign(u.size(), 0);
+        uint64_t rest = 0;
+        for (size_t i = u.size(); i-- > 0;) {
+            uint64_t cur = (rest << 32) | u[i];
+            q[i] = static_cast<uint32_t>(cur / v[0]);
+            rest = cur % v[0];
+        }
+        r.assign(1, static_cast<uint32_t>(rest));
+    } else {
+        divideLimbs(u, v, q, r);
+    }
 
-    std::reverse(result.begin(), result.end());
-    return Hex(result);
+    if (quotient != nullptr) *quotient = fromLimbs(q, resource);
+    if (remainder != nullptr) *remainder = fromLimbs(r, resource);
 }
 
-// Сравнение чисел на равенство
-bool Hex::equals(const Hex& other) const {
-    if (this->numSize != other.numSize) return false;
+// Удаление незначащих нулей в старших цифрах
+void Hex::trim() {
+    while (numSize > 1 && dataHex[numSize - 1] == '0') {
+        --numSize;
+    }
+}
 
-    for (size_t i = 0; i < this->numSize; ++i) {
-        if (this->dataHex[i] != other.dataHex[i]) return false;
+// Число из двоичных 32-битных разрядов (младший разряд первый)
+Hex Hex::fromLimbs(const std::pmr::vector<uint32_t>& limbs, std::pmr::memory_resource* resource) {
+    Hex result(resource);
+    result.allocate(std::max<size_t>(limbs.size() * 8, 1));
+    result.dataHex[0] = '0';
+    for (size_t i = 0; i < limbs.size() * 8; ++i) {
+        result.dataHex[i] = digitChar((limbs[i / 8] >> (4 * (i % 8))) & 0xF);
     }
-    return true;
+    result.trim();
+    return result;
+}
+
+// Сравнение чисел на равенство
+bool Hex::equals(const Hex& other) const {
+    return *this == other;
 }
 
 // Сравнение чисел (знак больше)
 bool Hex::greater(const Hex& other) const {
-    if (this->numSize > other.numSize) return true;
-    if (this->numSize < other.numSize) return false;
-
-    size_t sz = this->numSize;
-    for (size_t i = 0; i < sz; ++i) {
-        int this_val = isdigit(this->dataHex[sz - i - 1]) ? this->dataHex[sz - i - 1] - '0' : this->dataHex[sz - i - 1] - 'A' + 10;
-        int other_val = isdigit(other.dataHex[sz - i - 1]) ? other.dataHex[sz - i - 1] - '0' : other.dataHex[sz - i - 1] - 'A' + 10;
-        if (this_val > other_val) return true;
-        if (this_val < other_val) return false;
-    }
-    return false; // равны
+    return (*this <=> other) > 0;
 }
 
 // Сравнение чисел (знак меньше)
 bool Hex::less(const Hex& other) const {
-    return other.greater(*this);
+    return (*this <=> other) < 0;
+}
+
+// Трехстороннее сравнение (по 8 цифр за раз от старших к младшим)
+std::strong_ordering Hex::operator<=>(const Hex& other) const {
+    if (this->numSize != other.numSize) return this->numSize <=> other.numSize;
+    if (this->dataHex == other.dataHex) return std::strong_ordering::equal;
+
+    size_t i = this->numSize;
+    for (; i >= sizeof(uint64_t); i -= sizeof(uint64_t)) {
+        uint64_t this_word = loadWord(this->dataHex, i - sizeof(uint64_t));
+        uint64_t other_word = loadWord(other.dataHex, i - sizeof(uint64_t));
+        if (this_word != other_word) return this_word <=> other_word;
+    }
+    for (; i > 0; --i) {
+        if (this->dataHex[i - 1] != other.dataHex[i - 1]) return this->dataHex[i - 1] <=> other.dataHex[i - 1];
+    }
+    return std::strong_ordering::equal; // равны
+}
+
+// Сравнение на равенство
+bool Hex::operator==(const Hex& other) const {
+    if (this->numSize != other.numSize) return false;
+    return this->dataHex == other.dataHex || std::memcmp(this->dataHex, other.dataHex, this->numSize) == 0;
+}
+
+// 64-битный хеш цифр числа (для std::hash)
+size_t Hex::hash() const {
+    uint64_t h = mix(numSize + 0x9E3779B97F4A7C15ULL);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= numSize; i += sizeof(uint64_t)) {
+        h = (h ^ loadWord(dataHex, i)) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 29;
+    }
+    uint64_t tail = 0;
+    for (size_t shift = 0; i < numSize; ++i, shift += 8) {
+        tail |= static_cast<uint64_t>(dataHex[i]) << shift;
+    }
+    return static_cast<size_t>(mix(h ^ tail));
 }
 
 // Вывод массива в поток
@@ -291,14 +611,15 @@ std::ostream& Hex::print(std::ostream& outputStream) {
     return outputStream;
 }
 
-// === РЕАЛИЗАЦИЯ ДЕСТРУКТОРА ===
+// Запись числа строкой (старшие цифры впереди)
+std::string Hex::toString() const {
+    return std::string(std::make_reverse_iterator(dataHex + numSize), std::make_reverse_iterator(dataHex));
+}
 
-// Деструктор - освобождает динамическую память
-Hex::~Hex() noexcept {    
-    if (dataHex != nullptr) {
-        delete[] dataHex;
-        dataHex = nullptr;
-    }
+// === РЕАЛИЗАЦИЯ ДЕСТРУКТОРА ===
 
+// Деструктор - освобождает буфер, если это был последний владелец
+Hex::~Hex() noexcept {
+    release();
     numSize = 0;
-}
\ No newline at end of file
+}
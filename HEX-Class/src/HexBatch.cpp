@@ -0,0 +1,240 @@
+#include "../include/HexBatch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+// Числа обрабатываются блоками: для блока проходим все разряды, переносы держим на стеке
+constexpr size_t BLOCK = 256;
+
+// Деление диапазона [0, count) на threads непрерывных кусков и запуск func(begin, end) на каждом
+template <typename Func>
+void parallelChunks(size_t count, size_t threads, Func func) {
+    threads = std::max<size_t>(1, std::min(threads, (count + BLOCK - 1) / BLOCK));
+    if (threads == 1) {
+        func(size_t(0), count);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    size_t chunk = (count + threads - 1) / threads;
+    for (size_t t = 1; t < threads; ++t) {
+        size_t begin = std::min(count, t * chunk);
+        size_t end = std::min(count, begin + chunk);
+        workers.emplace_back(func, begin, end);
+    }
+    func(size_t(0), std::min(count, chunk));
+    for (auto& worker : workers) worker.join();
+}
+
+// Значение 16-ричной цифры по ее символу
+inline uint64_t digitValue(unsigned char ch) {
+    return ch <= '9' ? ch - '0' : ch - 'A' + 10;
+}
+
+} // namespace
+
+// === КОНСТРУКТОРЫ ===
+
+HexBatch::HexBatch() : HexBatch(0, 1) {}
+
+HexBatch::HexBatch(size_t count, size_t width) : count(count), width(width) {
+    if (width == 0) {
+        throw std::logic_error("Ширина чисел пакета должна быть положительной");
+    }
+    limbsNum = (width + DIGITS_PER_LIMB - 1) / DIGITS_PER_LIMB;
+    limbs.assign(limbsNum * count, 0);
+}
+
+HexBatch::HexBatch(const std::vector<Hex>& values, size_t width) : HexBatch(values.size(), width) {
+    for (size_t i = 0; i < count; ++i) {
+        set(i, values[i]);
+    }
+}
+
+// === ГЕТТЕРЫ И СЕТТЕРЫ ===
+
+size_t HexBatch::getSize() const { return count; }
+
+size_t HexBatch::getWidth() const { return width; }
+
+size_t HexBatch::getLimbs() const { return limbsNum; }
+
+uint64_t HexBatch::getLimb(size_t index, size_t limb) const {
+    if (index >= count || limb >= limbsNum) {
+        throw std::out_of_range("Индекс вне диапазона пакета");
+    }
+    return limbs[limb * count + index];
+}
+
+Hex HexBatch::get(size_t index) const {
+    if (index >= count) {
+        throw std::out_of_range("Индекс вне диапазона пакета");
+    }
+    static const char DIGITS[] = "0123456789ABCDEF";
+    std::string digits(width, '0');
+    for (size_t i = 0; i < width; ++i) {
+        uint64_t limb = limbs[(i / DIGITS_PER_LIMB) * count + index];
+        digits[width - 1 - i] = DIGITS[(limb >> (4 * (i % DIGITS_PER_LIMB))) & 0xF];
+    }
+    return Hex(digits);
+}
+
+void HexBatch::set(size_t index, const Hex& value) {
+    if (index >= count) {
+        throw std::out_of_range("Индекс вне диапазона пакета");
+    }
+    if (value.getSize() > width) {
+        throw std::logic_error("Число не помещается в ширину пакета");
+    }
+    for (size_t limb = 0; limb < limbsNum; ++limb) {
+        limbs[limb * count + index] = 0;
+    }
+    for (size_t i = 0; i < value.getSize(); ++i) {
+        limbs[(i / DIGITS_PER_LIMB) * count + index] |= digitValue(value.getDigit(i)) << (4 * (i % DIGITS_PER_LIMB));
+    }
+}
+
+// === ПОЭЛЕМЕНТНЫЕ ОПЕРАЦИИ ===
+
+HexBatch HexBatch::add(const HexBatch& other, size_t threads) const {
+    checkShape(other);
+    HexBatch result(count, width);
+    const uint64_t mask = topMask();
+    std::atomic<bool> overflow(false);
+
+    parallelChunks(count, threads, [&](size_t begin, size_t end) {
+        uint64_t carry[BLOCK];
+        for (size_t block = begin; block < end; block += BLOCK) {
+            size_t n = std::min(BLOCK, end - block);
+            std::fill(carry, carry + n, 0);
+            for (size_t limb = 0; limb < limbsNum; ++limb) {
+                const uint64_t* a = limbs.data() + limb * count + block;
+                const uint64_t* b = other.limbs.data() + limb * count + block;
+                uint64_t* r = result.limbs.data() + limb * count + block;
+                for (size_t i = 0; i < n; ++i) {
+                    uint64_t sum = a[i] + b[i];
+                    uint64_t withCarry = sum + carry[i];
+                    carry[i] = (sum < a[i]) | (withCarry < sum);
+                    r[i] = withCarry;
+                }
+            }
+            // Перенос из старшего разряда или выход за ширину - переполнение
+            const uint64_t* top = result.limbs.data() + (limbsNum - 1) * count + block;
+            uint64_t bad = 0;
+            for (size_t i = 0; i < n; ++i) {
+                bad |= carry[i] | (top[i] & ~mask);
+            }
+            if (bad) overflow.store(true, std::memory_order_relaxed);
+        }
+    });
+
+    if (overflow.load()) {
+        throw std::logic_error("Результат сложения не помещается в ширину пакета");
+    }
+    return result;
+}
+
+HexBatch HexBatch::subtract(const HexBatch& other, size_t threads) const {
+    checkShape(other);
+    HexBatch result(count, width);
+    std::atomic<bool> negative(false);
+
+    parallelChunks(count, threads, [&](size_t begin, size_t end) {
+        uint64_t borrow[BLOCK];
+        for (size_t block = begin; block < end; block += BLOCK) {
+            size_t n = std::min(BLOCK, end - block);
+            std::fill(borrow, borrow + n, 0);
+            for (size_t limb = 0; limb < limbsNum; ++limb) {
+                const uint64_t* a = limbs.data() + limb * count + block;
+                const uint64_t* b = other.limbs.data() + limb * count + block;
+                uint64_t* r = result.limbs.data() + limb * count + block;
+                for (size_t i = 0; i < n; ++i) {
+                    uint64_t diff = a[i] - b[i];
+                    uint64_t withBorrow = diff - borrow[i];
+                    borrow[i] = (a[i] < b[i]) | (diff < borrow[i]);
+                    r[i] = withBorrow;
+                }
+            }
+            uint64_t bad = 0;
+            for (size_t i = 0; i < n; ++i) {
+                bad |= borrow[i];
+            }
+            if (bad) negative.store(true, std::memory_order_relaxed);
+        }
+    });
+
+    if (negative.load()) {
+        throw std::logic_error("Результат вычислений не может быть отрицательным");
+    }
+    return result;
+}
+
+std::vector<int> HexBatch::compare(const HexBatch& other, size_t threads) const {
+    checkShape(other);
+    std::vector<int> result(count, 0);
+
+    parallelChunks(count, threads, [&](size_t begin, size_t end) {
+        int* r = result.data();
+        // Идем от старшего разряда к младшему, первый отличающийся разряд решает
+        for (size_t limb = limbsNum; limb-- > 0;) {
+            const uint64_t* a = limbs.data() + limb * count;
+            const uint64_t* b = other.limbs.data() + limb * count;
+            for (size_t i = begin; i < end; ++i) {
+                int current = (a[i] > b[i]) - (a[i] < b[i]);
+                r[i] = r[i] != 0 ? r[i] : current;
+            }
+        }
+    });
+    return result;
+}
+
+HexBatch HexBatch::min(const HexBatch& other, size_t threads) const {
+    std::vector<int> order = compare(other, threads);
+    HexBatch result(count, width);
+
+    parallelChunks(count, threads, [&](size_t begin, size_t end) {
+        for (size_t limb = 0; limb < limbsNum; ++limb) {
+            const uint64_t* a = limbs.data() + limb * count;
+            const uint64_t* b = other.limbs.data() + limb * count;
+            uint64_t* r = result.limbs.data() + limb * count;
+            for (size_t i = begin; i < end; ++i) {
+                r[i] = order[i] <= 0 ? a[i] : b[i];
+            }
+        }
+    });
+    return result;
+}
+
+HexBatch HexBatch::max(const HexBatch& other, size_t threads) const {
+    std::vector<int> order = compare(other, threads);
+    HexBatch result(count, width);
+
+    parallelChunks(count, threads, [&](size_t begin, size_t end) {
+        for (size_t limb = 0; limb < limbsNum; ++limb) {
+            const uint64_t* a = limbs.data() + limb * count;
+            const uint64_t* b = other.limbs.data() + limb * count;
+            uint64_t* r = result.limbs.data() + limb * count;
+            for (size_t i = begin; i < end; ++i) {
+                r[i] = order[i] >= 0 ? a[i] : b[i];
+            }
+        }
+    });
+    return result;
+}
+
+// === ВСПОМОГАТЕЛЬНЫЕ МЕТОДЫ ===
+
+void HexBatch::checkShape(const HexBatch& other) const {
+    if (count != other.count || width != other.width) {
+        throw std::logic_error("Пакеты должны совпадать по размеру и ширине");
+    }
+}
+
+uint64_t HexBatch::topMask() const {
+    size_t topDigits = width - (limbsNum - 1) * DIGITS_PER_LIMB;
+    return topDigits == DIGITS_PER_LIMB ? ~uint64_t(0) : (uint64_t(1) << (4 * topDigits)) - 1;
+}
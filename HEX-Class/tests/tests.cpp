@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include "../include/Hex.hpp"
+#include "../include/HexBatch.hpp"
 #include <sstream>
+#include <memory_resource>
+#include <unordered_map>
 
 // Тесты для конструкторов
 
@@ -90,6 +93,87 @@ TEST(HexTest, MoveConstructor) {
     EXPECT_EQ(a.getSize(), 0);
 }
 
+// Тесты для копирования при записи
+
+TEST(HexTest, CopySharesBuffer) {
+    Hex a("12A");
+    Hex b(a);
+    EXPECT_TRUE(a.isShared());
+    EXPECT_EQ(b.useCount(), 2);
+    EXPECT_TRUE(a.equals(b));
+}
+
+TEST(HexTest, SetDigitDetachesSharedBuffer) {
+    Hex a("12A");
+    Hex b(a);
+    b.setDigit(0, 'B');
+    EXPECT_FALSE(a.isShared());
+    EXPECT_FALSE(b.isShared());
+    EXPECT_EQ(a.getDigit(0), 'A');
+    EXPECT_EQ(b.getDigit(0), 'B');
+}
+
+TEST(HexTest, SetDigitTrimsLeadingZeros) {
+    Hex a("10A");
+    a.setDigit(2, '0');
+    EXPECT_EQ(a.getSize(), 1);
+    EXPECT_EQ(a.getDigit(0), 'A');
+    EXPECT_THROW(a.setDigit(5, '1'), std::out_of_range);
+    EXPECT_THROW(a.setDigit(0, 'G'), std::logic_error);
+}
+
+TEST(HexTest, CopyAssignment) {
+    Hex a("FF");
+    Hex b("1");
+    b = a;
+    EXPECT_EQ(a.useCount(), 2);
+    EXPECT_TRUE(b.equals(a));
+}
+
+TEST(HexTest, DeepCopy) {
+    Hex a("FF");
+    Hex b = a.deepCopy();
+    EXPECT_FALSE(a.isShared());
+    EXPECT_TRUE(b.equals(a));
+}
+
+// Тесты для ресурсов памяти
+
+TEST(HexTest, ResultsUseLeftOperandResource) {
+    // Память берется только из локального буфера, выход за его пределы - исключение
+    unsigned char storage[4096];
+    std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage), std::pmr::null_memory_resource());
+    Hex a("FFFF", &arena);
+    Hex b("1", &arena);
+    Hex c = a.add(b);
+    Hex d = c.subtract(b);
+    EXPECT_EQ(c.getResource(), &arena);
+    EXPECT_EQ(d.getResource(), &arena);
+    EXPECT_TRUE(d.equals(a));
+}
+
+TEST(HexTest, CopyIntoOtherResource) {
+    std::pmr::monotonic_buffer_resource arena;
+    Hex a("12A", &arena);
+    Hex b(a, std::pmr::get_default_resource());
+    EXPECT_FALSE(a.isShared());
+    EXPECT_EQ(b.getResource(), std::pmr::get_default_resource());
+    EXPECT_TRUE(b.equals(a));
+
+    Hex c(a, &arena);
+    EXPECT_TRUE(a.isShared());
+}
+
+TEST(HexTest, AssignmentKeepsOwnResource) {
+    std::pmr::monotonic_buffer_resource arena;
+    Hex a("12A", &arena);
+    Hex b("1");
+    b = a;
+    EXPECT_EQ(b.getResource(), std::pmr::get_default_resource());
+    EXPECT_FALSE(a.isShared());
+    EXPECT_TRUE(b.equals(a));
+}
+
 // Тесты для операций
 
 TEST(HexTest, AddSimple) {
@@ -157,6 +241,53 @@ TEST(HexTest, SubtractLargerFromSmaller) {
     EXPECT_THROW(a.subtract(b), std::logic_error);
 }
 
+TEST(HexTest, Multiply) {
+    EXPECT_EQ(Hex("FF").multiply(Hex("FF")).toString(), "FE01");
+    EXPECT_EQ(Hex("0").multiply(Hex("123")).toString(), "0");
+    EXPECT_EQ(Hex("FFFFFFFFFFFFFFFF").multiply(Hex("FFFFFFFFFFFFFFFF")).toString(), "FFFFFFFFFFFFFFFE0000000000000001");
+}
+
+TEST(HexTest, DivideAndMod) {
+    EXPECT_EQ(Hex("FE01").divide(Hex("FF")).toString(), "FF");
+    EXPECT_EQ(Hex("FE02").mod(Hex("FF")).toString(), "1");
+    EXPECT_EQ(Hex("5").divide(Hex("10")).toString(), "0");
+    EXPECT_EQ(Hex("5").mod(Hex("10")).toString(), "5");
+    EXPECT_THROW(Hex("5").divide(Hex("0")), std::logic_error);
+}
+
+TEST(HexTest, DivideMultiLimb) {
+    Hex a("FFFFFFFFFFFFFFFE0000000000000001");
+    Hex b("FFFFFFFFFFFFFFFF");
+    EXPECT_EQ(a.divide(b).toString(), "FFFFFFFFFFFFFFFF");
+    EXPECT_EQ(a.mod(b).toString(), "0");
+
+    // Сверка с 128-битной арифметикой
+    unsigned __int128 x = (static_cast<unsigned __int128>(0x123456789ABCDEF0ULL) << 64) | 0x0FEDCBA987654321ULL;
+    unsigned __int128 y = (static_cast<unsigned __int128>(0x1ULL) << 64) | 0x8000000000000003ULL;
+    auto toHex = [](unsigned __int128 value) {
+        std::string digits;
+        do {
+            digits.insert(digits.begin(), "0123456789ABCDEF"[static_cast<int>(value & 0xF)]);
+            value >>= 4;
+        } while (value != 0);
+        return digits;
+    };
+    Hex hx(toHex(x));
+    Hex hy(toHex(y));
+    EXPECT_EQ(hx.divide(hy).toString(), toHex(x / y));
+    EXPECT_EQ(hx.mod(hy).toString(), toHex(x % y));
+    EXPECT_TRUE(hx.divide(hy).multiply(hy).add(hx.mod(hy)).equals(hx));
+}
+
+TEST(HexTest, Shifts) {
+    EXPECT_EQ(Hex("1").shiftLeft(5).toString(), "20");
+    EXPECT_EQ(Hex("F").shiftLeft(1).toString(), "1E");
+    EXPECT_EQ(Hex("ABC").shiftLeft(0).toString(), "ABC");
+    EXPECT_EQ(Hex("1E").shiftRight(1).toString(), "F");
+    EXPECT_EQ(Hex("ABCD").shiftRight(6).toString(), "2AF");
+    EXPECT_EQ(Hex("ABCD").shiftRight(64).toString(), "0");
+}
+
 TEST(HexTest, EqualsTrue) {
     Hex a("12A");
     Hex b("12A");
@@ -217,6 +348,28 @@ TEST(HexTest, LessEqual) {
     EXPECT_FALSE(a.less(b));
 }
 
+TEST(HexTest, ThreeWayCompareLongNumbers) {
+    Hex a("123456789ABCDEF0123");
+    Hex b("123456789ABCDEF0124");
+    Hex c("F23456789ABCDEF0123");
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(c > b);
+    EXPECT_TRUE(a == Hex("0123456789ABCDEF0123"));
+    EXPECT_EQ(a <=> a, std::strong_ordering::equal);
+    EXPECT_TRUE(Hex("A") > Hex("9"));
+    EXPECT_TRUE(Hex("FFFFFFFF") < Hex("100000000"));
+}
+
+TEST(HexTest, HashAsUnorderedMapKey) {
+    std::unordered_map<Hex, int> map;
+    map[Hex("12A")] = 1;
+    map[Hex("123456789ABCDEF0123")] = 2;
+    EXPECT_EQ(map.at(Hex("0012A")), 1);
+    EXPECT_EQ(map.at(Hex("123456789ABCDEF0123")), 2);
+    EXPECT_EQ(map.count(Hex("12B")), 0);
+    EXPECT_EQ(std::hash<Hex>()(Hex("12A")), std::hash<Hex>()(Hex({'1', '2', 'A'})));
+}
+
 // Тест для вывода
 
 TEST(HexTest, Print) {
@@ -226,6 +379,100 @@ TEST(HexTest, Print) {
     EXPECT_EQ(oss.str(), "12A");
 }
 
+TEST(HexTest, ToString) {
+    EXPECT_EQ(Hex("0012A").toString(), "12A");
+    EXPECT_EQ(Hex().toString(), "");
+}
+
+// Тесты для пакетов чисел
+
+TEST(HexBatchTest, StoreAndLoad) {
+    HexBatch batch({Hex("12A"), Hex("FFFFFFFFFFFFFFFFF"), Hex("0")}, 20);
+    EXPECT_EQ(batch.getSize(), 3);
+    EXPECT_EQ(batch.getLimbs(), 2);
+    EXPECT_EQ(batch.getLimb(1, 1), 0xF);
+    EXPECT_TRUE(batch.get(1).equals(Hex("FFFFFFFFFFFFFFFFF")));
+    EXPECT_THROW(batch.set(0, Hex("1000000000000000000000")), std::logic_error);
+}
+
+TEST(HexBatchTest, IndexOutOfRange) {
+    HexBatch batch({Hex("12A")}, 20);
+    EXPECT_THROW(batch.get(1), std::out_of_range);
+    EXPECT_THROW(batch.getLimb(1, 0), std::out_of_range);
+    EXPECT_THROW(batch.getLimb(0, 2), std::out_of_range);
+    EXPECT_THROW(batch.set(1, Hex("1")), std::out_of_range);
+}
+
+TEST(HexBatchTest, EmptyBatch) {
+    HexBatch a(0, 20);
+    HexBatch b(0, 20);
+    EXPECT_EQ(a.add(b, 4).getSize(), 0);
+    EXPECT_EQ(a.subtract(b).getSize(), 0);
+    EXPECT_TRUE(a.compare(b).empty());
+    EXPECT_EQ(a.min(b).getSize(), 0);
+    EXPECT_EQ(a.max(b).getSize(), 0);
+    EXPECT_THROW(a.get(0), std::out_of_range);
+}
+
+TEST(HexBatchTest, AddWithCarryBetweenLimbs) {
+    HexBatch a({Hex("FFFFFFFFFFFFFFFF"), Hex("1")}, 20);
+    HexBatch b({Hex("1"), Hex("2")}, 20);
+    HexBatch c = a.add(b);
+    EXPECT_TRUE(c.get(0).equals(Hex("10000000000000000")));
+    EXPECT_TRUE(c.get(1).equals(Hex("3")));
+}
+
+TEST(HexBatchTest, AddOverflowThrows) {
+    HexBatch a({Hex("FF")}, 2);
+    HexBatch b({Hex("1")}, 2);
+    EXPECT_THROW(a.add(b), std::logic_error);
+}
+
+TEST(HexBatchTest, SubtractWithBorrowBetweenLimbs) {
+    HexBatch a({Hex("10000000000000000"), Hex("5")}, 17);
+    HexBatch b({Hex("1"), Hex("5")}, 17);
+    HexBatch c = a.subtract(b);
+    EXPECT_TRUE(c.get(0).equals(Hex("FFFFFFFFFFFFFFFF")));
+    EXPECT_TRUE(c.get(1).equals(Hex("0")));
+    EXPECT_THROW(b.subtract(a), std::logic_error);
+}
+
+TEST(HexBatchTest, CompareMinMax) {
+    HexBatch a({Hex("10000000000000000"), Hex("5"), Hex("7")}, 17);
+    HexBatch b({Hex("FFFFFFFFFFFFFFFF"), Hex("5"), Hex("8")}, 17);
+    EXPECT_EQ(a.compare(b), std::vector<int>({1, 0, -1}));
+    HexBatch low = a.min(b);
+    HexBatch high = a.max(b);
+    EXPECT_TRUE(low.get(0).equals(Hex("FFFFFFFFFFFFFFFF")));
+    EXPECT_TRUE(low.get(2).equals(Hex("7")));
+    EXPECT_TRUE(high.get(0).equals(Hex("10000000000000000")));
+    EXPECT_TRUE(high.get(2).equals(Hex("8")));
+}
+
+TEST(HexBatchTest, ParallelMatchesSerial) {
+    std::vector<Hex> left;
+    std::vector<Hex> right;
+    for (int i = 0; i < 3000; ++i) {
+        std::string x(20, '0');
+        std::string y(20, '0');
+        for (int j = 0; j < 20; ++j) {
+            x[j] = "0123456789ABCDEF"[(i * 7 + j * 3) % 16];
+            y[j] = "0123456789ABCDEF"[(i * 5 + j * 11) % 16];
+        }
+        left.emplace_back(x);
+        right.emplace_back(y);
+    }
+    HexBatch a(left, 21);
+    HexBatch b(right, 21);
+    HexBatch serial = a.add(b, 1);
+    HexBatch parallel = a.add(b, 4);
+    EXPECT_EQ(a.compare(b, 1), a.compare(b, 4));
+    for (size_t i = 0; i < serial.getSize(); ++i) {
+        EXPECT_TRUE(serial.get(i).equals(parallel.get(i)));
+        EXPECT_TRUE(serial.get(i).equals(left[i].add(right[i])));
+    }
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();